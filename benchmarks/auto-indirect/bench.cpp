@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Benchmarks the three strategies of auto_indirect_adapter against
+ * records of increasing sizes, both trivially copyable ones and ones
+ * holding an std::string, in order to find the record sizes at which
+ * the indirect sort and the key/index radix sort start to beat the
+ * direct sort.
+ */
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/adapters/auto_indirect_adapter.h>
+#include <cpp-sort/adapters/indirect_adapter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+
+using namespace std::chrono_literals;
+
+////////////////////////////////////////////////////////////
+// Benchmark configuration variables
+
+// Number of records to sort
+std::size_t size = 200'000;
+
+// Maximum time to let the benchmark run for a given record type
+auto max_run_time = 3s;
+// Maximum number of benchmark runs per record type
+std::size_t max_runs = 25;
+
+////////////////////////////////////////////////////////////
+// Records
+
+template<std::size_t Size>
+struct trivial_record
+{
+    std::uint32_t key;
+    char payload[Size - sizeof(std::uint32_t)];
+};
+
+template<std::size_t Size>
+struct string_record
+{
+    std::string text;
+    std::uint32_t key;
+    char payload[Size - sizeof(std::uint32_t) - sizeof(std::string)];
+};
+
+template<typename Record>
+auto make_record(std::uint32_t key)
+    -> Record
+{
+    Record res{};
+    res.key = key;
+    return res;
+}
+
+////////////////////////////////////////////////////////////
+// Benchmark code proper
+
+template<typename Record, typename Sorter>
+auto time_it(Sorter sorter, std::uint_fast32_t seed)
+    -> double
+{
+    // Always use a steady clock
+    using clock_type = std::conditional_t<
+        std::chrono::high_resolution_clock::is_steady,
+        std::chrono::high_resolution_clock,
+        std::chrono::steady_clock
+    >;
+
+    std::mt19937 engine(seed);
+    std::vector<Record> dataset;
+    dataset.reserve(size);
+    for (std::size_t i = 0 ; i < size ; ++i) {
+        dataset.push_back(make_record<Record>(engine()));
+    }
+
+    std::vector<double> times;
+    auto total_start = clock_type::now();
+    auto total_end = clock_type::now();
+    while (std::chrono::duration_cast<std::chrono::seconds>(total_end - total_start) < max_run_time &&
+           times.size() < max_runs) {
+        std::vector<Record> collection = dataset;
+        auto start = clock_type::now();
+        sorter(collection, &Record::key);
+        auto end = clock_type::now();
+        assert(std::is_sorted(collection.begin(), collection.end(),
+                              [](const auto& lhs, const auto& rhs) { return lhs.key < rhs.key; }));
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        total_end = clock_type::now();
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+template<typename Record>
+auto benchmark(const char* kind, std::uint_fast32_t seed)
+    -> void
+{
+    // Thresholds of 0 force the radix strategy
+    double direct = time_it<Record>(cppsort::pdq_sorter{}, seed);
+    double indirect = time_it<Record>(cppsort::indirect_adapter<cppsort::pdq_sorter>{}, seed);
+    double radix = time_it<Record>(cppsort::auto_indirect_adapter<cppsort::pdq_sorter, 0, 0>{}, seed);
+
+    std::cout << kind << ", " << sizeof(Record) << ", "
+              << direct << ", " << indirect << ", " << radix << std::endl;
+}
+
+template<std::size_t... Sizes>
+auto benchmark_all(std::uint_fast32_t seed, std::index_sequence<Sizes...>)
+    -> void
+{
+    using expander = int[];
+    (void) expander{ (benchmark<trivial_record<Sizes>>("trivial", seed), 0)... };
+    (void) expander{ (benchmark<string_record<Sizes>>("string", seed), 0)... };
+}
+
+int main()
+{
+    // Poor seed, yet enough for our benchmarks
+    std::uint_fast32_t seed = std::time(nullptr);
+    std::cout << "SEED: " << seed << '\n'
+              << "kind, record size, direct (ms), indirect (ms), radix (ms)\n";
+
+    benchmark_all(seed, std::index_sequence<
+        48, 64, 96, 112, 128, 136, 144, 160, 192, 256, 320, 384, 448, 512
+    >{});
+}
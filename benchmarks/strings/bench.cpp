@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Benchmarks string sorters against collections of URL-like strings,
+ * which share long common prefixes. A file containing one string per
+ * line can be passed as the first parameter to benchmark a real-world
+ * dataset instead of the generated one.
+ */
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/adapters/stable_adapter.h>
+#include <cpp-sort/sorters.h>
+
+// Type of collection to sort
+using collection_t = std::vector<std::string>;
+
+// Handy function pointer alias
+using sort_f = void (*)(collection_t&);
+
+auto generate_urls(std::size_t size, std::uint_fast32_t seed)
+    -> collection_t
+{
+    static const char* const hosts[] = {
+        "https://en.wikipedia.org/wiki/",
+        "https://www.example.com/",
+        "https://www.example.com/blog/",
+        "https://github.com/",
+        "http://archive.example.org/pub/mirrors/",
+    };
+    static const char* const words[] = {
+        "sort", "string", "index", "user", "page", "2020", "archive",
+        "list", "item", "category", "search", "doc", "api", "v1", "v2",
+    };
+
+    std::mt19937 engine(seed);
+    collection_t res;
+    res.reserve(size);
+    for (std::size_t i = 0 ; i < size ; ++i) {
+        std::string url = hosts[engine() % 5];
+        auto segments = 1 + engine() % 4;
+        for (std::size_t j = 0 ; j < segments ; ++j) {
+            url += words[engine() % 15];
+            url += j + 1 == segments ? '_' : '/';
+        }
+        url += std::to_string(engine() % 10000);
+        res.push_back(std::move(url));
+    }
+    return res;
+}
+
+int main(int argc, char** argv)
+{
+    using namespace std::chrono_literals;
+
+    // Always use a steady clock
+    using clock_type = std::conditional_t<
+        std::chrono::high_resolution_clock::is_steady,
+        std::chrono::high_resolution_clock,
+        std::chrono::steady_clock
+    >;
+
+    std::pair<std::string, sort_f> sorts[] = {
+        { "lcp_merge_sort",                         cppsort::lcp_merge_sort },
+        { "merge_sort",                             cppsort::merge_sort     },
+        { "stable_adapter<pdq_sorter>",             [](collection_t& collection) {
+            cppsort::stable_adapter<cppsort::pdq_sorter>{}(collection);
+        }},
+        { "spread_sort (unstable)",                 cppsort::spread_sort    },
+        { "burst_sort (unstable)",                  cppsort::burst_sort     },
+        { "multikey_quick_sort (unstable)",         cppsort::multikey_quick_sort }
+    };
+
+    // Either read the dataset from a file or generate it
+    collection_t dataset;
+    if (argc > 1) {
+        std::ifstream input(argv[1]);
+        for (std::string line ; std::getline(input, line) ;) {
+            dataset.push_back(std::move(line));
+        }
+    } else {
+        // Poor seed, yet enough for our benchmarks
+        std::uint_fast32_t seed = std::time(nullptr);
+        std::cerr << "SEED: " << seed << '\n';
+        dataset = generate_urls(1'000'000, seed);
+    }
+
+    for (auto& sort: sorts) {
+        std::vector<double> times;
+
+        auto total_start = clock_type::now();
+        auto total_end = clock_type::now();
+        while (std::chrono::duration_cast<std::chrono::seconds>(total_end - total_start) < 5s) {
+            collection_t collection = dataset;
+            auto start = clock_type::now();
+            sort.second(collection);
+            auto end = clock_type::now();
+            assert(std::is_sorted(std::begin(collection), std::end(collection)));
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            total_end = clock_type::now();
+        }
+
+        std::sort(std::begin(times), std::end(times));
+        std::cout << dataset.size() << ", " << sort.first
+                  << ", " << times[times.size() / 2] << " ms\n";
+    }
+}
@@ -42,5 +42,10 @@ class CppSortConan(ConanFile):
         for file in ["LICENSE.txt", "NOTICE.txt"]:
             self.copy(file, dst="licenses")
 
+    def package_info(self):
+        # Some utilities perform I/O in background threads
+        if self.settings.os in ["Linux", "FreeBSD"]:
+            self.cpp_info.system_libs = ["pthread"]
+
     def package_id(self):
         self.info.header_only()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2018 Morwenn
+ * Copyright (c) 2015-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_ADAPTERS_H_
@@ -8,11 +8,13 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cpp-sort/adapters/auto_indirect_adapter.h>
 #include <cpp-sort/adapters/container_aware_adapter.h>
 #include <cpp-sort/adapters/counting_adapter.h>
 #include <cpp-sort/adapters/hybrid_adapter.h>
 #include <cpp-sort/adapters/indirect_adapter.h>
 #include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/adapters/prefix_cache_adapter.h>
 #include <cpp-sort/adapters/schwartz_adapter.h>
 #include <cpp-sort/adapters/self_sort_adapter.h>
 #include <cpp-sort/adapters/small_array_adapter.h>
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_AUTO_INDIRECT_ADAPTER_H_
+#define CPPSORT_ADAPTERS_AUTO_INDIRECT_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/adapters/indirect_adapter.h>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/sort_permutation.h>
+#include "../detail/apply_permutation.h"
+#include "../detail/checkers.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Ways to sort a collection depending on the cost of moving
+        // its elements around
+
+        enum struct indirection_strategy
+        {
+            // Sort the elements directly with the adapted sorter
+            in_place,
+            // Sort iterators with the adapted sorter
+            indirect,
+            // Radix sort (key, index) pairs then move the elements
+            key_index_radix
+        };
+
+        template<typename Value>
+        constexpr auto move_cost()
+            -> std::size_t
+        {
+            // Trivially copyable types are moved with a plain memory
+            // copy, other types are moved member by member: with the
+            // records of benchmarks/auto-indirect, which hold an
+            // std::string, the crossovers of both strategies happen
+            // at roughly a fifth of the size measured for trivially
+            // copyable records
+            return std::is_trivially_copyable<Value>::value ?
+                   sizeof(Value) : 5 * sizeof(Value);
+        }
+
+        template<
+            typename Iterator,
+            typename Compare,
+            typename Projection,
+            std::size_t IndirectThreshold,
+            std::size_t RadixThreshold
+        >
+        constexpr auto select_indirection_strategy()
+            -> indirection_strategy
+        {
+            using value_t = remove_cvref_t<rvalue_reference_t<Iterator>>;
+            using key_t = projected_t<Iterator, Projection>;
+            using category = iterator_category_t<Iterator>;
+
+            if (move_cost<value_t>() > RadixThreshold &&
+                std::is_base_of<std::random_access_iterator_tag, category>::value &&
+                utility::detail::is_index_pair_sortable<Compare, key_t, std::uint32_t>::value) {
+                return indirection_strategy::key_index_radix;
+            }
+            if (move_cost<value_t>() > IndirectThreshold) {
+                return indirection_strategy::indirect;
+            }
+            return indirection_strategy::in_place;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Algorithm proper
+
+        template<typename Sorter, typename ForwardIterator, typename Compare, typename Projection>
+        auto sort_auto_indirect(std::integral_constant<indirection_strategy, indirection_strategy::in_place>,
+                                const Sorter& sorter, ForwardIterator first, ForwardIterator last,
+                                Compare compare, Projection projection)
+            -> decltype(auto)
+        {
+            return sorter(std::move(first), std::move(last),
+                          std::move(compare), std::move(projection));
+        }
+
+        template<typename Sorter, typename ForwardIterator, typename Compare, typename Projection>
+        auto sort_auto_indirect(std::integral_constant<indirection_strategy, indirection_strategy::indirect>,
+                                const Sorter& sorter, ForwardIterator first, ForwardIterator last,
+                                Compare compare, Projection projection)
+            -> decltype(auto)
+        {
+            auto size = std::distance(first, last);
+            return sort_indirectly(iterator_category_t<ForwardIterator>{},
+                                   sorter, first, last, size,
+                                   std::move(compare), std::move(projection));
+        }
+
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_key_index_radix(RandomAccessIterator first, RandomAccessIterator last,
+                                  Compare compare, Projection projection)
+            -> void
+        {
+            auto indices = utility::detail::sort_permutation<Index, true>(
+                ska_sorter{}, first, last, last - first,
+                std::move(compare), std::move(projection)
+            );
+            apply_permutation(first, indices.size(), [&indices](std::size_t pos) {
+                return static_cast<std::size_t>(indices[pos]);
+            });
+        }
+
+        template<typename Sorter, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_auto_indirect(std::integral_constant<indirection_strategy, indirection_strategy::key_index_radix>,
+                                const Sorter&, RandomAccessIterator first, RandomAccessIterator last,
+                                Compare compare, Projection projection)
+            -> void
+        {
+            // The keys are radix sorted along with the indices, which
+            // gives a stable result whatever the adapted sorter
+            auto size = last - first;
+            if (static_cast<std::uintmax_t>(size) <= std::numeric_limits<std::uint32_t>::max()) {
+                sort_key_index_radix<std::uint32_t>(first, last, std::move(compare), std::move(projection));
+            } else {
+                sort_key_index_radix<std::size_t>(first, last, std::move(compare), std::move(projection));
+            }
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Adapter
+
+        template<
+            typename Sorter,
+            std::size_t IndirectThreshold,
+            std::size_t RadixThreshold
+        >
+        struct auto_indirect_adapter_impl:
+            utility::adapter_storage<Sorter>,
+            check_iterator_category<Sorter>,
+            check_is_always_stable<Sorter>
+        {
+            auto_indirect_adapter_impl() = default;
+
+            constexpr explicit auto_indirect_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = std::enable_if_t<is_projection_iterator_v<
+                    Projection, ForwardIterator, Compare
+                >>
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                using strategy = std::integral_constant<
+                    indirection_strategy,
+                    select_indirection_strategy<
+                        ForwardIterator, Compare, Projection,
+                        IndirectThreshold, RadixThreshold
+                    >()
+                >;
+                return sort_auto_indirect(strategy{}, this->get(),
+                                          std::move(first), std::move(last),
+                                          std::move(compare), std::move(projection));
+            }
+        };
+    }
+
+    template<typename Sorter, std::size_t IndirectThreshold, std::size_t RadixThreshold>
+    struct auto_indirect_adapter:
+        sorter_facade<detail::auto_indirect_adapter_impl<
+            Sorter, IndirectThreshold, RadixThreshold
+        >>
+    {
+        auto_indirect_adapter() = default;
+
+        constexpr explicit auto_indirect_adapter(Sorter sorter):
+            sorter_facade<detail::auto_indirect_adapter_impl<
+                Sorter, IndirectThreshold, RadixThreshold
+            >>(std::move(sorter))
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // is_stable specialization
+
+    template<
+        typename Sorter,
+        std::size_t IndirectThreshold,
+        std::size_t RadixThreshold,
+        typename... Args
+    >
+    struct is_stable<auto_indirect_adapter<Sorter, IndirectThreshold, RadixThreshold>(Args...)>:
+        is_stable<Sorter(Args...)>
+    {};
+}
+
+#endif // CPPSORT_ADAPTERS_AUTO_INDIRECT_ADAPTER_H_
@@ -8,12 +8,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <deque>
 #include <functional>
 #include <type_traits>
 #include <utility>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/adapter_storage.h>
+#include "../detail/container_aware/deque.h"
 #include "../detail/projection_compare.h"
 #include "../detail/type_traits.h"
 
@@ -334,6 +336,84 @@ namespace cppsort
             {
                 return this->get()(iterable, std::move(compare), std::move(projection));
             }
+
+            ////////////////////////////////////////////////////////////
+            // std::deque: sort a contiguous copy of the elements
+
+            template<
+                bool Stability = false,
+                typename T,
+                typename Allocator
+            >
+            auto operator()(std::deque<T, Allocator>& iterable) const
+                -> conditional_t<
+                    Stability,
+                    cppsort::is_stable<Sorter(T*, T*)>,
+                    deque_sort_result_t<Sorter, T>
+                >
+            {
+                return deque_sort(this->get(), iterable);
+            }
+
+            template<
+                bool Stability = false,
+                typename T,
+                typename Allocator,
+                typename Compare
+            >
+            auto operator()(std::deque<T, Allocator>& iterable, Compare compare) const
+                -> std::enable_if_t<
+                    is_projection_v<utility::identity, std::deque<T, Allocator>, Compare>,
+                    conditional_t<
+                        Stability,
+                        cppsort::is_stable<Sorter(T*, T*, Compare)>,
+                        deque_sort_result_t<Sorter, T, Compare>
+                    >
+                >
+            {
+                return deque_sort(this->get(), iterable, std::move(compare));
+            }
+
+            template<
+                bool Stability = false,
+                typename T,
+                typename Allocator,
+                typename Projection
+            >
+            auto operator()(std::deque<T, Allocator>& iterable, Projection projection) const
+                -> std::enable_if_t<
+                    is_projection_v<Projection, std::deque<T, Allocator>>,
+                    conditional_t<
+                        Stability,
+                        cppsort::is_stable<Sorter(T*, T*, Projection)>,
+                        deque_sort_result_t<Sorter, T, Projection>
+                    >
+                >
+            {
+                return deque_sort(this->get(), iterable, std::move(projection));
+            }
+
+            template<
+                bool Stability = false,
+                typename T,
+                typename Allocator,
+                typename Compare,
+                typename Projection
+            >
+            auto operator()(std::deque<T, Allocator>& iterable,
+                            Compare compare, Projection projection) const
+                -> std::enable_if_t<
+                    is_projection_v<Projection, std::deque<T, Allocator>, Compare>,
+                    conditional_t<
+                        Stability,
+                        cppsort::is_stable<Sorter(T*, T*, Compare, Projection)>,
+                        deque_sort_result_t<Sorter, T, Compare, Projection>
+                    >
+                >
+            {
+                return deque_sort(this->get(), iterable,
+                                  std::move(compare), std::move(projection));
+            }
         };
     }
 
@@ -361,6 +441,10 @@ namespace cppsort
     {};
 }
 
+#ifdef CPPSORT_ADAPTERS_OUT_OF_PLACE_ADAPTER_DONE_
+#include "../detail/container_aware/out_of_place.h"
+#endif
+
 #ifdef CPPSORT_SORTERS_INSERTION_SORTER_DONE_
 #include "../detail/container_aware/insertion_sort.h"
 #endif
@@ -126,4 +126,10 @@ namespace cppsort
     {};
 }
 
+#ifdef CPPSORT_ADAPTERS_CONTAINER_AWARE_ADAPTER_DONE_
+#include "../detail/container_aware/out_of_place.h"
+#endif
+
+#define CPPSORT_ADAPTERS_OUT_OF_PLACE_ADAPTER_DONE_
+
 #endif // CPPSORT_ADAPTERS_OUT_OF_PLACE_ADAPTER_H_
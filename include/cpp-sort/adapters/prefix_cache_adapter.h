@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_PREFIX_CACHE_ADAPTER_H_
+#define CPPSORT_ADAPTERS_PREFIX_CACHE_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/associate_iterator.h"
+#include "../detail/checkers.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/memory.h"
+#include "../detail/string_key.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Comparisons handled by the adapter: the natural order of
+        // standard strings and its reverse
+
+        template<typename Compare, typename T>
+        struct is_prefix_cacheable:
+            std::integral_constant<bool,
+                is_string_key<T>::value && (
+                    std::is_same<Compare, std::less<>>::value ||
+                    std::is_same<Compare, std::greater<>>::value
+                )
+            >
+        {};
+
+        ////////////////////////////////////////////////////////////
+        // Comparison of the associations: compare the cached prefixes
+        // first, then the full strings past the common prefix when
+        // the cached prefixes are equal
+
+        template<bool Reversed, typename Projection>
+        struct prefix_compare
+        {
+            Projection projection;
+
+            template<typename T, typename U>
+            auto operator()(const T& lhs, const U& rhs) const
+                -> bool
+            {
+                if (lhs.data != rhs.data) {
+                    return Reversed ? rhs.data < lhs.data : lhs.data < rhs.data;
+                }
+
+                auto&& proj = utility::as_function(projection);
+                auto&& lhs_str = proj(lhs.get());
+                auto&& rhs_str = proj(rhs.get());
+                using string_type = remove_cvref_t<decltype(lhs_str)>;
+
+                // Equal prefixes mean equal characters until one
+                // of the strings or the prefix ends
+                std::size_t depth = chars_per_prefix<string_type>();
+                if (lhs_str.size() < depth) depth = lhs_str.size();
+                if (rhs_str.size() < depth) depth = rhs_str.size();
+
+                int res = compare_from(lhs_str, rhs_str, depth);
+                return Reversed ? res > 0 : res < 0;
+            }
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Algorithm proper
+
+        template<typename ForwardIterator>
+        using prefix_iterator_t = associate_iterator<association<ForwardIterator, std::uint64_t>*>;
+
+        template<
+            bool Reversed,
+            typename ForwardIterator,
+            typename Projection,
+            typename Sorter
+        >
+        auto sort_with_prefix_cache(ForwardIterator first, difference_type_t<ForwardIterator> size,
+                                    Projection projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            auto&& proj = utility::as_function(projection);
+            using value_t = association<ForwardIterator, std::uint64_t>;
+            using difference_type = difference_type_t<ForwardIterator>;
+
+            // Collection of cached prefixes
+            std::unique_ptr<value_t, operator_deleter> prefixes(
+                static_cast<value_t*>(::operator new(size * sizeof(value_t))),
+                operator_deleter(size * sizeof(value_t))
+            );
+            destruct_n<value_t> d(0);
+            std::unique_ptr<value_t, destruct_n<value_t>&> h2(prefixes.get(), d);
+
+            // Associate iterator to the prefix of the projected element
+            auto ptr = prefixes.get();
+            for (difference_type count = 0 ; count != size ; ++count) {
+                ::new(ptr) value_t(first, string_prefix(proj(*first)));
+                ++d;
+                ++first;
+                ++ptr;
+            }
+
+            // Indirectly sort the original sequence
+            return std::forward<Sorter>(sorter)(
+                make_associate_iterator(prefixes.get()),
+                make_associate_iterator(prefixes.get() + size),
+                prefix_compare<Reversed, Projection>{std::move(projection)}
+            );
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Adapter
+
+        template<typename Sorter>
+        struct prefix_cache_adapter_impl:
+            utility::adapter_storage<Sorter>,
+            check_iterator_category<Sorter>,
+            check_is_always_stable<Sorter>
+        {
+            prefix_cache_adapter_impl() = default;
+
+            constexpr explicit prefix_cache_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare={}, Projection projection={}) const
+                -> std::enable_if_t<
+                    is_prefix_cacheable<Compare, projected_t<ForwardIterator, Projection>>::value,
+                    decltype(this->get()(
+                        std::declval<prefix_iterator_t<ForwardIterator>>(),
+                        std::declval<prefix_iterator_t<ForwardIterator>>(),
+                        std::declval<prefix_compare<std::is_same<Compare, std::greater<>>::value, Projection>>()
+                    ))
+                >
+            {
+                return sort_with_prefix_cache<std::is_same<Compare, std::greater<>>::value>(
+                    first, std::distance(first, last), std::move(projection), this->get()
+                );
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> std::enable_if_t<
+                    not is_prefix_cacheable<Compare, projected_t<ForwardIterator, Projection>>::value,
+                    decltype(this->get()(std::move(first), std::move(last),
+                                         std::move(compare), std::move(projection)))
+                >
+            {
+                // Nothing to cache, forward everything to the adapted sorter
+                return this->get()(std::move(first), std::move(last),
+                                   std::move(compare), std::move(projection));
+            }
+        };
+    }
+
+    template<typename Sorter>
+    struct prefix_cache_adapter:
+        sorter_facade<detail::prefix_cache_adapter_impl<Sorter>>
+    {
+        prefix_cache_adapter() = default;
+
+        constexpr explicit prefix_cache_adapter(Sorter sorter):
+            sorter_facade<detail::prefix_cache_adapter_impl<Sorter>>(std::move(sorter))
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // is_stable specialization
+
+    template<typename Sorter, typename... Args>
+    struct is_stable<prefix_cache_adapter<Sorter>(Args...)>:
+        is_stable<Sorter(Args...)>
+    {};
+}
+
+#endif // CPPSORT_ADAPTERS_PREFIX_CACHE_ADAPTER_H_
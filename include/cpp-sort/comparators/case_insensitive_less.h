@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019 Morwenn
+ * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_COMPARATORS_CASE_INSENSITIVE_LESS_H_
@@ -9,11 +9,16 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <algorithm>
+#include <climits>
 #include <iterator>
 #include <locale>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/static_const.h>
+#include "../detail/case_folding.h"
+#include "../detail/string_key.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -39,6 +44,47 @@ namespace cppsort
             }
         };
 
+        ////////////////////////////////////////////////////////////
+        // Case insensitive comparison with a cached facet, used by
+        // the refined comparators: contiguous char sequences use a
+        // faster algorithm folding several characters at once
+
+        template<typename T, bool = is_case_foldable_string<T>::value>
+        struct sequence_case_insensitive_less
+        {
+            using char_type = remove_cvref_t<decltype(*std::begin(std::declval<T&>()))>;
+
+            const std::ctype<char_type>& ct;
+
+            explicit sequence_case_insensitive_less(const std::ctype<char_type>& ct):
+                ct(ct)
+            {}
+
+            auto operator()(const T& lhs, const T& rhs) const
+                -> bool
+            {
+                return std::lexicographical_compare(std::begin(lhs), std::end(lhs),
+                                                    std::begin(rhs), std::end(rhs),
+                                                    char_less<char_type>(ct));
+            }
+        };
+
+        template<typename T>
+        struct sequence_case_insensitive_less<T, true>
+        {
+            char_case_folder folder;
+
+            explicit sequence_case_insensitive_less(const std::ctype<char>& ct):
+                folder(ct)
+            {}
+
+            auto operator()(const T& lhs, const T& rhs) const
+                -> bool
+            {
+                return folder.less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+            }
+        };
+
         template<typename T>
         auto case_insensitive_less(const T& lhs, const T& rhs, const std::locale& loc)
             -> bool
@@ -173,13 +219,13 @@ namespace cppsort
                     using char_type = remove_cvref_t<decltype(*std::begin(std::declval<T&>()))>;
 
                     std::locale loc;
-                    const std::ctype<char_type>& ct;
+                    sequence_case_insensitive_less<T> compare;
 
                 public:
 
                     explicit refined_case_insensitive_less_locale_fn(const std::locale& loc):
                         loc(loc),
-                        ct(std::use_facet<std::ctype<char_type>>(loc))
+                        compare(std::use_facet<std::ctype<char_type>>(this->loc))
                     {}
 
                     template<typename U=T>
@@ -199,9 +245,7 @@ namespace cppsort
                             bool
                         >
                     {
-                        return std::lexicographical_compare(std::begin(lhs), std::end(lhs),
-                                                            std::begin(rhs), std::end(rhs),
-                                                            char_less<char_type>(ct));
+                        return compare(lhs, rhs);
                     }
             };
 
@@ -213,13 +257,13 @@ namespace cppsort
                     using char_type = remove_cvref_t<decltype(*std::begin(std::declval<T&>()))>;
 
                     std::locale loc;
-                    const std::ctype<char_type>& ct;
+                    sequence_case_insensitive_less<T> compare;
 
                 public:
 
                     refined_case_insensitive_less_fn():
                         loc(),
-                        ct(std::use_facet<std::ctype<char_type>>(loc))
+                        compare(std::use_facet<std::ctype<char_type>>(loc))
                     {}
 
                     template<typename U=T>
@@ -255,9 +299,7 @@ namespace cppsort
                             bool
                         >
                     {
-                        return std::lexicographical_compare(std::begin(lhs), std::end(lhs),
-                                                            std::begin(rhs), std::end(rhs),
-                                                            char_less<char_type>(ct));
+                        return compare(lhs, rhs);
                     }
 
                     auto operator()(const std::locale& loc) const
@@ -269,13 +311,107 @@ namespace cppsort
         }
     }
 
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Case-folded keys: strings whose natural order is the order
+        // of case_insensitive_less, meant to be computed once per
+        // element and sorted with the string sorters
+
+        template<typename CharT>
+        auto fold_key_char(CharT value)
+            -> CharT
+        {
+            return value;
+        }
+
+        inline auto fold_key_char(char value)
+            -> char
+        {
+            // case_insensitive_less compares char values while the
+            // order of std::string is the one of unsigned char
+            if (std::is_signed<char>::value) {
+                return static_cast<char>(
+                    static_cast<unsigned char>(value) ^ (1u << (CHAR_BIT - 1))
+                );
+            }
+            return value;
+        }
+
+        template<typename String>
+        auto make_case_insensitive_key(const String& value, const std::locale& loc)
+            -> std::basic_string<typename String::value_type>
+        {
+            using char_type = typename String::value_type;
+
+            std::basic_string<char_type> res(value.data(), value.size());
+            if (not res.empty()) {
+                auto& ct = std::use_facet<std::ctype<char_type>>(loc);
+                ct.tolower(&res[0], &res[0] + res.size());
+                for (auto& c: res) {
+                    c = fold_key_char(c);
+                }
+            }
+            return res;
+        }
+
+        struct case_insensitive_key_locale_fn:
+            utility::projection_base
+        {
+            private:
+
+                std::locale loc;
+
+            public:
+
+                explicit case_insensitive_key_locale_fn(const std::locale& loc):
+                    loc(loc)
+                {}
+
+                template<typename String>
+                auto operator()(const String& value) const
+                    -> std::enable_if_t<
+                        is_string_key<String>::value,
+                        std::basic_string<typename String::value_type>
+                    >
+                {
+                    return make_case_insensitive_key(value, loc);
+                }
+        };
+
+        struct case_insensitive_key_fn:
+            utility::projection_base
+        {
+            template<typename String>
+            auto operator()(const String& value) const
+                -> std::enable_if_t<
+                    is_string_key<String>::value,
+                    std::basic_string<typename String::value_type>
+                >
+            {
+                return make_case_insensitive_key(value, std::locale());
+            }
+
+            auto operator()(const std::locale& loc) const
+                -> case_insensitive_key_locale_fn
+            {
+                return case_insensitive_key_locale_fn(loc);
+            }
+        };
+    }
+
     using case_insensitive_less_t = detail::case_insensitive_less_fn;
+    using case_insensitive_key_t = detail::case_insensitive_key_fn;
 
     namespace
     {
         constexpr auto&& case_insensitive_less = utility::static_const<
             detail::case_insensitive_less_fn
         >::value;
+
+        constexpr auto&& case_insensitive_key = utility::static_const<
+            detail::case_insensitive_key_fn
+        >::value;
     }
 }
 
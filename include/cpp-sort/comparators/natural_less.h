@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019 Morwenn
+ * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_COMPARATORS_NATURAL_LESS_H_
@@ -9,8 +9,12 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <cctype>
+#include <climits>
+#include <cstddef>
 #include <iterator>
+#include <string>
 #include <utility>
+#include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/static_const.h>
 
 namespace cppsort
@@ -19,6 +23,17 @@ namespace cppsort
     {
         ////////////////////////////////////////////////////////////
         // Natural order for char sequences
+        //
+        // Sequences of digits are compared according to the numbers
+        // they represent regardless of their leading zeros, while
+        // the other characters are compared one by one with the same
+        // order as std::char_traits<char>
+
+        inline auto is_natural_digit(char value)
+            -> bool
+        {
+            return std::isdigit(static_cast<unsigned char>(value));
+        }
 
         template<typename ForwardIterator1, typename ForwardIterator2>
         auto natural_less_impl(ForwardIterator1 begin1, ForwardIterator1 end1,
@@ -26,27 +41,23 @@ namespace cppsort
             -> bool
         {
             while (begin1 != end1 && begin2 != end2) {
-                auto last1 = begin1;
-                auto last2 = begin2;
-                do {
-                    if (not std::isdigit(*last1)) break;
-                    ++last1;
-                } while (last1 != end1);
-                do {
-                    if (not std::isdigit(*last2)) break;
-                    ++last2;
-                } while (last2 != end2);
-
-                if (last1 != begin1 && last2 != begin2) {
+                if (is_natural_digit(*begin1) && is_natural_digit(*begin2)) {
                     // Skip leading zeros
-                    do {
-                        if (*begin1 != '0') break;
+                    while (begin1 != end1 && *begin1 == '0') {
                         ++begin1;
-                    } while (begin1 != last1);
-                    do {
-                        if (*begin2 != '0') break;
+                    }
+                    while (begin2 != end2 && *begin2 == '0') {
                         ++begin2;
-                    } while (begin2 != last2);
+                    }
+
+                    auto last1 = begin1;
+                    while (last1 != end1 && is_natural_digit(*last1)) {
+                        ++last1;
+                    }
+                    auto last2 = begin2;
+                    while (last2 != end2 && is_natural_digit(*last2)) {
+                        ++last2;
+                    }
 
                     // Compare numbers
                     auto size1 = std::distance(begin1, last1);
@@ -54,31 +65,17 @@ namespace cppsort
                     if (size1 != size2) {
                         return size1 < size2;
                     }
-                    if (size1 == 0) {
-                        return false;
-                    }
-
-                    // Sizes are equal and not 0
-                    while (begin1 != end1) {
+                    for (; begin1 != last1 ; ++begin1, (void) ++begin2) {
                         if (*begin1 != *begin2) {
                             return *begin1 < *begin2;
                         }
-                        ++begin1;
-                        ++begin2;
                     }
-                }
-
-                if (begin1 == end1) {
-                    return begin2 != end2;
-                }
-                if (begin2 == end2) {
-                    return false;
+                    continue;
                 }
 
                 if (*begin1 != *begin2) {
-                    return *begin1 < *begin2;
+                    return static_cast<unsigned char>(*begin1) < static_cast<unsigned char>(*begin2);
                 }
-
                 ++begin1;
                 ++begin2;
             }
@@ -109,15 +106,85 @@ namespace cppsort
 
             using is_transparent = void;
         };
+
+        ////////////////////////////////////////////////////////////
+        // Natural order key
+        //
+        // Every character that is not a digit is copied as is, and
+        // every sequence of digits is encoded as '0', followed by the
+        // number of bytes needed to store the number of significant
+        // digits, that number in big-endian order, and the significant
+        // digits themselves: comparing two keys lexicographically as
+        // std::string does gives the same result as natural_less
+
+        template<typename ForwardIterator>
+        auto make_natural_key(ForwardIterator first, ForwardIterator last)
+            -> std::string
+        {
+            std::string res;
+            while (first != last) {
+                if (not is_natural_digit(*first)) {
+                    res.push_back(*first);
+                    ++first;
+                    continue;
+                }
+
+                // Compared to any other character, the sequence of
+                // digits behaves as its first digit
+                res.push_back('0');
+
+                while (first != last && *first == '0') {
+                    ++first;
+                }
+                auto digits_end = first;
+                std::size_t size = 0;
+                while (digits_end != last && is_natural_digit(*digits_end)) {
+                    ++digits_end;
+                    ++size;
+                }
+
+                // Encode the length so that longer numbers compare greater
+                unsigned char length_bytes = 0;
+                for (auto tmp = size ; tmp != 0 ; tmp >>= CHAR_BIT) {
+                    ++length_bytes;
+                }
+                res.push_back(static_cast<char>(length_bytes));
+                for (int i = length_bytes - 1 ; i >= 0 ; --i) {
+                    res.push_back(static_cast<char>(
+                        static_cast<unsigned char>(size >> (i * CHAR_BIT))
+                    ));
+                }
+
+                res.append(first, digits_end);
+                first = digits_end;
+            }
+            return res;
+        }
+
+        struct natural_key_fn:
+            utility::projection_base
+        {
+            template<typename T>
+            auto operator()(const T& value) const
+                -> decltype(make_natural_key(std::begin(value), std::end(value)))
+            {
+                return make_natural_key(std::begin(value), std::end(value));
+            }
+        };
     }
 
     using natural_less_t = detail::natural_less_fn;
+    using natural_key_t = detail::natural_key_fn;
 
     namespace
     {
         constexpr auto&& natural_less = utility::static_const<
             detail::natural_less_fn
         >::value;
+
+        constexpr auto&& natural_key = utility::static_const<
+            detail::natural_key_fn
+        >::value;
     }
 }
 
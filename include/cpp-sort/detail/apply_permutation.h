@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_APPLY_PERMUTATION_H_
+#define CPPSORT_DETAIL_APPLY_PERMUTATION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/iter_move.h>
+#include "config.h"
+#include "iterator_traits.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Prefetch the element pointed by an iterator when it is a
+    // real object in memory, do nothing for proxy iterators
+
+    template<typename Iterator>
+    auto prefetch_element(Iterator it)
+        -> std::enable_if_t<std::is_lvalue_reference<reference_t<Iterator>>::value>
+    {
+        CPPSORT_PREFETCH(std::addressof(*it));
+    }
+
+    template<typename Iterator>
+    auto prefetch_element(Iterator)
+        -> std::enable_if_t<not std::is_lvalue_reference<reference_t<Iterator>>::value>
+    {}
+
+    ////////////////////////////////////////////////////////////
+    // Distance at which the sources of the elements are prefetched
+    // when the permutation is applied out of place
+
+    constexpr std::size_t permutation_prefetch_distance = 8;
+
+    ////////////////////////////////////////////////////////////
+    // Out-of-place permutations are split into blocks of output
+    // positions, and the blocks are distributed among several
+    // threads when there are enough elements
+
+    constexpr std::size_t permutation_block_size = 4096;
+    constexpr std::size_t parallel_permutation_threshold = 1 << 16;
+
+    ////////////////////////////////////////////////////////////
+    // Reorder the elements of a sequence in place so that the
+    // element at position pos is the one that was at position
+    // source_index(pos): the cycles of the permutation are walked
+    // so that every element is moved only once, and the source of
+    // the next move is prefetched while the current one happens
+
+    template<typename RandomAccessIterator, typename SourceIndex>
+    auto apply_permutation(RandomAccessIterator first, std::size_t size,
+                           SourceIndex source_index)
+        -> void
+    {
+        using utility::iter_move;
+
+        std::vector<bool> sorted(size, false);
+        for (std::size_t start = 0 ; start != size ; ++start) {
+            if (sorted[start]) {
+                continue;
+            }
+            sorted[start] = true;
+
+            std::size_t next = source_index(start);
+            if (next == start) {
+                continue;
+            }
+
+            // Process the current cycle
+            auto tmp = iter_move(first + start);
+            std::size_t current = start;
+            while (next != start) {
+                std::size_t after = source_index(next);
+                prefetch_element(first + after);
+                first[current] = iter_move(first + next);
+                sorted[next] = true;
+                current = next;
+                next = after;
+            }
+            first[current] = std::move(tmp);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Write the elements at the positions [begin, end) of the
+    // permuted sequence to an output iterator: the writes are
+    // sequential and the random reads are prefetched a few steps
+    // in advance
+
+    template<
+        typename RandomAccessIterator,
+        typename OutputIterator,
+        typename SourceIndex
+    >
+    auto gather_permutation(RandomAccessIterator first, std::size_t begin, std::size_t end,
+                            SourceIndex& source_index, OutputIterator result)
+        -> OutputIterator
+    {
+        std::size_t prefetched = end - begin < permutation_prefetch_distance ?
+                                 end : begin + permutation_prefetch_distance;
+        for (std::size_t pos = begin ; pos != prefetched ; ++pos) {
+            prefetch_element(first + source_index(pos));
+        }
+
+        for (std::size_t pos = begin ; pos != end ; ++pos) {
+            if (pos + permutation_prefetch_distance < end) {
+                prefetch_element(first + source_index(pos + permutation_prefetch_distance));
+            }
+            *result = first[source_index(pos)];
+            ++result;
+        }
+        return result;
+    }
+
+    template<
+        typename RandomAccessIterator,
+        typename OutputIterator,
+        typename SourceIndex
+    >
+    auto apply_permutation_copy(RandomAccessIterator first, std::size_t size,
+                                SourceIndex& source_index, OutputIterator result,
+                                std::output_iterator_tag)
+        -> OutputIterator
+    {
+        return gather_permutation(first, 0, size, source_index, std::move(result));
+    }
+
+    template<
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename SourceIndex
+    >
+    auto apply_permutation_copy(RandomAccessIterator1 first, std::size_t size,
+                                SourceIndex& source_index, RandomAccessIterator2 result,
+                                std::random_access_iterator_tag)
+        -> RandomAccessIterator2
+    {
+        using difference_type = difference_type_t<RandomAccessIterator2>;
+
+        std::size_t nb_blocks = (size + permutation_block_size - 1) / permutation_block_size;
+        std::size_t nb_tasks = 1;
+        if (size >= parallel_permutation_threshold) {
+            std::size_t nb_threads = std::thread::hardware_concurrency();
+            nb_tasks = nb_threads < nb_blocks ? nb_threads : nb_blocks;
+        }
+        if (nb_tasks <= 1) {
+            return gather_permutation(first, 0, size, source_index, std::move(result));
+        }
+
+        // Every task writes a contiguous run of whole blocks, the
+        // last one is handled by the current thread; the futures
+        // returned by std::async wait for their task when they are
+        // destroyed, so no task outlives the call even when one of
+        // them throws
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(nb_tasks - 1);
+        std::size_t begin = 0;
+        for (std::size_t task = 0 ; task != nb_tasks ; ++task) {
+            std::size_t task_blocks = nb_blocks / nb_tasks + (task < nb_blocks % nb_tasks);
+            std::size_t end = begin + task_blocks * permutation_block_size;
+            if (end > size) {
+                end = size;
+            }
+            auto out = result + static_cast<difference_type>(begin);
+            if (task + 1 == nb_tasks) {
+                gather_permutation(first, begin, end, source_index, out);
+            } else {
+                tasks.push_back(std::async(std::launch::async, [first, begin, end, &source_index, out] {
+                    gather_permutation(first, begin, end, source_index, out);
+                }));
+            }
+            begin = end;
+        }
+        for (auto& task: tasks) {
+            task.get();
+        }
+        return result + static_cast<difference_type>(size);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Write the elements of a sequence in the order given by the
+    // permutation to an output iterator; when the output iterator
+    // is random-access, big permutations are split in blocks that
+    // are gathered in parallel
+
+    template<
+        typename RandomAccessIterator,
+        typename OutputIterator,
+        typename SourceIndex
+    >
+    auto apply_permutation_copy(RandomAccessIterator first, std::size_t size,
+                                SourceIndex source_index, OutputIterator result)
+        -> OutputIterator
+    {
+        using category = std::conditional_t<
+            std::is_base_of<std::random_access_iterator_tag,
+                            iterator_category_t<OutputIterator>>::value,
+            std::random_access_iterator_tag,
+            std::output_iterator_tag
+        >;
+        return apply_permutation_copy(std::move(first), size, source_index,
+                                      std::move(result), category{});
+    }
+}}
+
+#endif // CPPSORT_DETAIL_APPLY_PERMUTATION_H_
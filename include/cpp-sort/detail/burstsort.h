@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_BURSTSORT_H_
+#define CPPSORT_DETAIL_BURSTSORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include "apply_permutation.h"
+#include "bitops.h"
+#include "iterator_traits.h"
+#include "multikey_quicksort.h"
+#include "string_key.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    //
+    // Burstsort, as described by Sinha and Zobel in "Cache-Conscious
+    // Sorting of Large Sets of Strings with Dynamic Tries": the
+    // indices of the strings are inserted into a trie whose leaves
+    // are small buckets, and a bucket that grows too big is burst
+    // into a new trie node whose buckets discriminate on the next
+    // character. The trie nodes are few and stay in cache, so the
+    // insertion step only reads every string once. The buckets are
+    // then sorted with multikey quicksort, which works on few
+    // enough strings to remain cache-resident, and the elements are
+    // finally moved to their position in the sorted sequence.
+    //
+    // The trie works on bytes: the characters of wide strings are
+    // split into their most significant byte first so that the
+    // order of the bytes matches the order of the characters.
+    //
+
+    namespace burstsort_detail
+    {
+        enum {
+            // Maximum size of a bucket before it bursts
+            burst_threshold = 8192
+        };
+
+        constexpr std::size_t radix = std::size_t(1) << CHAR_BIT;
+
+        template<typename String>
+        auto byte_at(const String& str, std::size_t depth)
+            -> std::size_t
+        {
+            // Returns 0 for the end of the string, byte + 1 otherwise
+            constexpr std::size_t char_size = sizeof(typename String::value_type);
+            std::size_t pos = depth / char_size;
+            if (pos >= str.size()) {
+                return 0;
+            }
+            auto shift = CHAR_BIT * (char_size - 1 - depth % char_size);
+            return ((char_rank(str[pos]) >> shift) & (radix - 1)) + 1;
+        }
+
+        struct trie_node
+        {
+            // Index 0 holds the strings that end at this node: they
+            // are all equal and never need to be sorted or burst
+            std::vector<std::size_t> buckets[radix + 1];
+            std::unique_ptr<trie_node> children[radix + 1];
+        };
+
+        // A bucket that can't be burst yet is checked again every
+        // time its size doubles, which keeps the checks linear
+        inline auto is_burst_candidate(std::size_t size)
+            -> bool
+        {
+            std::size_t count = size - 1;
+            return count >= burst_threshold && (count & (count - 1)) == 0;
+        }
+
+        // Whether all the strings of a bucket have the same byte at
+        // the given depth: bursting such a bucket would move all of
+        // them to a single bucket of the new node, and strings that
+        // share a long prefix would burst again at every byte
+        template<typename RandomAccessIterator, typename Projection>
+        auto shares_next_byte(const std::vector<std::size_t>& bucket, std::size_t depth,
+                              RandomAccessIterator first, Projection& projection)
+            -> bool
+        {
+            auto&& proj = utility::as_function(projection);
+
+            std::size_t byte = byte_at(proj(first[bucket.front()]), depth);
+            for (std::size_t idx: bucket) {
+                if (byte_at(proj(first[idx]), depth) != byte) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename RandomAccessIterator, typename Projection>
+        auto insert(trie_node* node, std::size_t depth, std::size_t index,
+                    RandomAccessIterator first, Projection& projection)
+            -> void
+        {
+            auto&& proj = utility::as_function(projection);
+
+            while (true) {
+                auto&& str = proj(first[index]);
+                std::size_t byte = byte_at(str, depth);
+                if (byte != 0 && node->children[byte]) {
+                    node = node->children[byte].get();
+                    ++depth;
+                    continue;
+                }
+
+                auto& bucket = node->buckets[byte];
+                bucket.push_back(index);
+                if (byte != 0 && is_burst_candidate(bucket.size()) &&
+                    not shares_next_byte(bucket, depth + 1, first, projection)) {
+                    // Burst the bucket into a new trie node
+                    auto child = std::make_unique<trie_node>();
+                    for (std::size_t idx: bucket) {
+                        insert(child.get(), depth + 1, idx, first, projection);
+                    }
+                    node->children[byte] = std::move(child);
+                    std::vector<std::size_t>().swap(bucket);
+                }
+                return;
+            }
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection>
+        auto collect_bucket(std::vector<std::size_t>& bucket, std::size_t depth,
+                            std::vector<std::uint64_t>& keys, RandomAccessIterator first,
+                            Projection& projection, std::size_t*& out)
+            -> void
+        {
+            auto&& proj = utility::as_function(projection);
+
+            if (bucket.empty()) {
+                return;
+            }
+
+            // Every string of the bucket shares the first depth bytes,
+            // hence at least that many whole characters
+            using string_type = projected_t<RandomAccessIterator, Projection>;
+            std::size_t char_depth = depth / sizeof(typename string_type::value_type);
+
+            // Buckets whose strings share their next byte can be
+            // bigger than the burst threshold
+            auto size = bucket.size();
+            if (keys.size() < size) {
+                keys.resize(size);
+            }
+            mkqs_detail::discard_lcp lcp;
+            mkqs_detail::multikey_quicksort_loop<Reversed>(
+                bucket.begin(), bucket.end(), keys.data(), char_depth, false,
+                static_cast<int>(detail::log2(size)),
+                [&proj, first](std::size_t idx) -> decltype(auto) {
+                    return proj(first[idx]);
+                },
+                lcp, 0
+            );
+            for (std::size_t idx: bucket) {
+                *out++ = idx;
+            }
+            std::vector<std::size_t>().swap(bucket);
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection>
+        auto collect(trie_node* node, std::size_t depth, std::vector<std::uint64_t>& keys,
+                     RandomAccessIterator first, Projection& projection,
+                     std::size_t*& out)
+            -> void
+        {
+            // The strings that end here come first in ascending order
+            // and last in descending order
+            if (not Reversed) {
+                for (std::size_t idx: node->buckets[0]) {
+                    *out++ = idx;
+                }
+            }
+
+            for (std::size_t i = 1 ; i <= radix ; ++i) {
+                std::size_t byte = Reversed ? radix + 1 - i : i;
+                if (node->children[byte]) {
+                    collect<Reversed>(node->children[byte].get(), depth + 1, keys,
+                                      first, projection, out);
+                    node->children[byte].reset();
+                } else {
+                    collect_bucket<Reversed>(node->buckets[byte], depth + 1, keys,
+                                             first, projection, out);
+                }
+            }
+
+            if (Reversed) {
+                for (std::size_t idx: node->buckets[0]) {
+                    *out++ = idx;
+                }
+            }
+        }
+    }
+
+    template<bool Reversed, typename RandomAccessIterator, typename Projection>
+    auto burstsort(RandomAccessIterator first, RandomAccessIterator last,
+                   Projection projection)
+        -> void
+    {
+        auto size = static_cast<std::size_t>(last - first);
+        if (size <= burstsort_detail::burst_threshold) {
+            // Small enough to directly fit in a single bucket
+            multikey_quicksort<Reversed>(std::move(first), std::move(last),
+                                         std::move(projection));
+            return;
+        }
+
+        // Distribute the indices of the elements into the trie
+        auto root = std::make_unique<burstsort_detail::trie_node>();
+        for (std::size_t idx = 0 ; idx < size ; ++idx) {
+            burstsort_detail::insert(root.get(), 0, idx, first, projection);
+        }
+
+        // Sort the buckets and gather the indices in sorted order
+        std::unique_ptr<std::size_t[]> order(new std::size_t[size]);
+        std::vector<std::uint64_t> keys(burstsort_detail::burst_threshold + 1);
+        std::size_t* out = order.get();
+        burstsort_detail::collect<Reversed>(root.get(), 0, keys,
+                                            first, projection, out);
+        root.reset();
+
+        // Move the elements to their sorted position
+        detail::apply_permutation(first, size, [&order](std::size_t pos) {
+            return order[pos];
+        });
+    }
+}}
+
+#endif // CPPSORT_DETAIL_BURSTSORT_H_
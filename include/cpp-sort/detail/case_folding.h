@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CASE_FOLDING_H_
+#define CPPSORT_DETAIL_CASE_FOLDING_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <locale>
+#include <string>
+#include <type_traits>
+
+#if __cplusplus > 201402L && __has_include(<string_view>)
+#   include <string_view>
+#endif
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Case folding of eight ASCII characters at once: only valid
+    // when none of the bytes has its most significant bit set,
+    // in which case no addition below can carry over the next byte
+
+    constexpr std::uint64_t swar_ones = 0x0101010101010101u;
+    constexpr std::uint64_t swar_high_bits = 0x8080808080808080u;
+
+    inline auto swar_ascii_tolower(std::uint64_t value)
+        -> std::uint64_t
+    {
+        std::uint64_t ge_a = value + swar_ones * (0x80 - 'A');
+        std::uint64_t gt_z = value + swar_ones * (0x80 - 'Z' - 1);
+        std::uint64_t is_upper = ge_a & ~gt_z & swar_high_bits;
+        // 0x80 >> 2 == 0x20 == 'a' - 'A'
+        return value | (is_upper >> 2);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Case folding of char sequences with a given ctype facet:
+    // the results of std::ctype<char>::tolower are cached in a
+    // table, and when the facet folds ASCII characters the same
+    // way as the classic locale, chunks of eight ASCII characters
+    // are folded and compared at once; the table gives the exact
+    // results whenever a chunk contains non-ASCII characters
+
+    class char_case_folder
+    {
+        public:
+
+            explicit char_case_folder(const std::ctype<char>& ct)
+            {
+                for (int i = 0 ; i < (1 << CHAR_BIT) ; ++i) {
+                    table_[i] = static_cast<char>(i);
+                }
+                ct.tolower(table_, table_ + (1 << CHAR_BIT));
+
+                ascii_is_classic_ = CHAR_BIT == 8 && sizeof(std::uint64_t) == 8;
+                for (int i = 0 ; i < 0x80 ; ++i) {
+                    int expected = (i >= 'A' && i <= 'Z') ? i + ('a' - 'A') : i;
+                    if (table_[i] != static_cast<char>(expected)) {
+                        ascii_is_classic_ = false;
+                    }
+                }
+            }
+
+            auto tolower(char value) const
+                -> char
+            {
+                return table_[static_cast<unsigned char>(value)];
+            }
+
+            auto less(const char* lhs, std::size_t lhs_size,
+                      const char* rhs, std::size_t rhs_size) const
+                -> bool
+            {
+                std::size_t size = lhs_size < rhs_size ? lhs_size : rhs_size;
+                std::size_t pos = 0;
+
+                if (ascii_is_classic_) {
+                    for (; pos + 8 <= size ; pos += 8) {
+                        std::uint64_t lhs_chunk, rhs_chunk;
+                        std::memcpy(&lhs_chunk, lhs + pos, 8);
+                        std::memcpy(&rhs_chunk, rhs + pos, 8);
+                        if (lhs_chunk == rhs_chunk) {
+                            continue;
+                        }
+                        if (((lhs_chunk | rhs_chunk) & swar_high_bits) == 0 &&
+                            swar_ascii_tolower(lhs_chunk) == swar_ascii_tolower(rhs_chunk)) {
+                            continue;
+                        }
+
+                        // Either there is a difference or non-ASCII
+                        // characters: compare the chunk precisely
+                        for (std::size_t i = pos ; i < pos + 8 ; ++i) {
+                            char lhs_lower = tolower(lhs[i]);
+                            char rhs_lower = tolower(rhs[i]);
+                            if (lhs_lower != rhs_lower) {
+                                return lhs_lower < rhs_lower;
+                            }
+                        }
+                    }
+                }
+
+                for (; pos < size ; ++pos) {
+                    char lhs_lower = tolower(lhs[pos]);
+                    char rhs_lower = tolower(rhs[pos]);
+                    if (lhs_lower != rhs_lower) {
+                        return lhs_lower < rhs_lower;
+                    }
+                }
+                return lhs_size < rhs_size;
+            }
+
+        private:
+
+            char table_[1 << CHAR_BIT];
+            bool ascii_is_classic_;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Contiguous char sequences handled by char_case_folder
+
+    template<typename T>
+    struct is_case_foldable_string:
+        std::false_type
+    {};
+
+    template<typename Allocator>
+    struct is_case_foldable_string<std::basic_string<char, std::char_traits<char>, Allocator>>:
+        std::true_type
+    {};
+
+#if __cplusplus > 201402L && __has_include(<string_view>)
+    template<>
+    struct is_case_foldable_string<std::string_view>:
+        std::true_type
+    {};
+#endif
+}}
+
+#endif // CPPSORT_DETAIL_CASE_FOLDING_H_
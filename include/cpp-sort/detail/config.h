@@ -61,6 +61,19 @@
 #   define CPPSORT_UNREACHABLE
 #endif
 
+////////////////////////////////////////////////////////////
+// CPPSORT_PREFETCH
+
+// Hint that the memory at the given address will soon be read,
+// used by algorithms whose memory accesses are random but known
+// a few steps in advance
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define CPPSORT_PREFETCH(address) __builtin_prefetch(address)
+#else
+#   define CPPSORT_PREFETCH(address)
+#endif
+
 ////////////////////////////////////////////////////////////
 // CPPSORT_ASSERT
 
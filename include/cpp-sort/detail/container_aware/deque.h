@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTAINER_AWARE_DEQUE_H_
+#define CPPSORT_DETAIL_CONTAINER_AWARE_DEQUE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../memory.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Every access through a deque iterator has to check whether
+    // it crosses the boundary of a block, which makes sorting
+    // algorithms noticeably slower than on contiguous memory; the
+    // layout of the blocks isn't portably exposed, so the elements
+    // are instead moved to a contiguous buffer, sorted with raw
+    // pointers, then moved back to the deque. When the buffer can't
+    // be allocated, the deque is sorted in place
+
+    template<typename Sorter, typename T, typename... Args>
+    using deque_sort_result_t = decltype(std::declval<const Sorter&>()(
+        std::declval<T*>(), std::declval<T*>(), std::declval<Args>()...
+    ));
+
+    template<typename Sorter, typename T, typename Allocator, typename... Args>
+    auto sort_staged_deque(std::true_type /* returns void */, const Sorter& sorter,
+                           std::deque<T, Allocator>& collection, T* buffer, std::size_t size,
+                           Args&&... args)
+        -> void
+    {
+        sorter(buffer, buffer + size, std::forward<Args>(args)...);
+        std::move(buffer, buffer + size, collection.begin());
+    }
+
+    template<typename Sorter, typename T, typename Allocator, typename... Args>
+    auto sort_staged_deque(std::false_type /* returns void */, const Sorter& sorter,
+                           std::deque<T, Allocator>& collection, T* buffer, std::size_t size,
+                           Args&&... args)
+        -> deque_sort_result_t<Sorter, T, Args...>
+    {
+        auto&& res = sorter(buffer, buffer + size, std::forward<Args>(args)...);
+        std::move(buffer, buffer + size, collection.begin());
+        return std::forward<decltype(res)>(res);
+    }
+
+    template<typename Sorter, typename T, typename Allocator, typename... Args>
+    auto deque_sort(const Sorter& sorter, std::deque<T, Allocator>& collection, Args&&... args)
+        -> deque_sort_result_t<Sorter, T, Args...>
+    {
+        auto size = collection.size();
+        std::unique_ptr<T, operator_deleter> buffer(
+            static_cast<T*>(::operator new(size * sizeof(T), std::nothrow)),
+            operator_deleter(size * sizeof(T))
+        );
+        if (buffer == nullptr) {
+            return sorter(collection.begin(), collection.end(), std::forward<Args>(args)...);
+        }
+
+        // Move the elements to the contiguous buffer
+        destruct_n<T> d(0);
+        std::unique_ptr<T, destruct_n<T>&> h2(buffer.get(), d);
+        auto ptr = buffer.get();
+        for (auto&& elem: collection) {
+            ::new(ptr) T(std::move(elem));
+            ++ptr;
+            ++d;
+        }
+
+        using returns_void = std::is_void<deque_sort_result_t<Sorter, T, Args...>>;
+        return sort_staged_deque(returns_void{}, sorter, collection, buffer.get(), size,
+                                 std::forward<Args>(args)...);
+    }
+}}
+
+#endif // CPPSORT_DETAIL_CONTAINER_AWARE_DEQUE_H_
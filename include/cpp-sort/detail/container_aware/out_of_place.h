@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTAINER_AWARE_OUT_OF_PLACE_H_
+#define CPPSORT_DETAIL_CONTAINER_AWARE_OUT_OF_PLACE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+
+namespace cppsort
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Instead of moving the values of a list to a buffer and
+        // back, handles to its nodes are sorted with a projection
+        // through the nodes, and the list is relinked in sorted
+        // order in a single pass: the values never move
+
+        template<typename Sorter, typename Handle, typename Compare, typename NodeProjection>
+        using relink_sort_result_t = decltype(std::declval<const Sorter&>()(
+            std::declval<std::vector<Handle>&>(),
+            std::declval<Compare>(), std::declval<NodeProjection>()
+        ));
+
+        template<typename Sorter, typename Handle, typename Compare,
+                 typename NodeProjection, typename Relink>
+        auto sort_and_relink(std::true_type /* returns void */, const Sorter& sorter,
+                             std::vector<Handle>& handles, Compare compare,
+                             NodeProjection projection, Relink relink)
+            -> void
+        {
+            sorter(handles, std::move(compare), std::move(projection));
+            relink();
+        }
+
+        template<typename Sorter, typename Handle, typename Compare,
+                 typename NodeProjection, typename Relink>
+        auto sort_and_relink(std::false_type /* returns void */, const Sorter& sorter,
+                             std::vector<Handle>& handles, Compare compare,
+                             NodeProjection projection, Relink relink)
+            -> relink_sort_result_t<Sorter, Handle, Compare, NodeProjection>
+        {
+            auto&& res = sorter(handles, std::move(compare), std::move(projection));
+            relink();
+            return std::forward<decltype(res)>(res);
+        }
+
+        template<typename Sorter, typename Handle, typename Compare,
+                 typename NodeProjection, typename Relink>
+        auto sort_and_relink(const Sorter& sorter, std::vector<Handle>& handles,
+                             Compare compare, NodeProjection projection, Relink relink)
+            -> relink_sort_result_t<Sorter, Handle, Compare, NodeProjection>
+        {
+            using returns_void = std::is_void<
+                relink_sort_result_t<Sorter, Handle, Compare, NodeProjection>
+            >;
+            return sort_and_relink(returns_void{}, sorter, handles,
+                                   std::move(compare), std::move(projection),
+                                   std::move(relink));
+        }
+
+        template<typename Projection>
+        struct list_node_projection
+        {
+            Projection projection;
+
+            template<typename Iterator>
+            auto operator()(Iterator it) const
+                -> decltype(utility::as_function(projection)(*it))
+            {
+                return utility::as_function(projection)(*it);
+            }
+        };
+
+        template<typename Projection>
+        struct flist_node_projection
+        {
+            Projection projection;
+
+            template<typename ForwardList>
+            auto operator()(ForwardList* node) const
+                -> decltype(utility::as_function(projection)(node->front()))
+            {
+                return utility::as_function(projection)(node->front());
+            }
+        };
+
+        template<typename Sorter, typename List, typename Compare, typename Projection>
+        using list_relink_sort_result_t = relink_sort_result_t<
+            Sorter, typename List::iterator, Compare,
+            list_node_projection<Projection>
+        >;
+
+        template<typename Sorter, typename ForwardList, typename Compare, typename Projection>
+        using flist_relink_sort_result_t = relink_sort_result_t<
+            Sorter, ForwardList*, Compare,
+            flist_node_projection<Projection>
+        >;
+
+        template<typename Sorter, typename Compare, typename Projection, typename... Args>
+        auto list_relink_sort(const Sorter& sorter, std::list<Args...>& collection,
+                              Compare compare, Projection projection)
+            -> list_relink_sort_result_t<Sorter, std::list<Args...>, Compare, Projection>
+        {
+            using iterator = typename std::list<Args...>::iterator;
+
+            // List iterators are never invalidated by splicing, they
+            // are used as handles to the nodes
+            std::vector<iterator> handles;
+            handles.reserve(collection.size());
+            for (auto it = collection.begin() ; it != collection.end() ; ++it) {
+                handles.push_back(it);
+            }
+
+            return sort_and_relink(
+                sorter, handles, std::move(compare),
+                list_node_projection<Projection>{std::move(projection)},
+                [&collection, &handles] {
+                    for (auto it: handles) {
+                        collection.splice(collection.end(), collection, it);
+                    }
+                }
+            );
+        }
+
+        template<typename Sorter, typename Compare, typename Projection, typename... Args>
+        auto flist_relink_sort(const Sorter& sorter, std::forward_list<Args...>& collection,
+                               Compare compare, Projection projection)
+            -> flist_relink_sort_result_t<Sorter, std::forward_list<Args...>, Compare, Projection>
+        {
+            using flist_t = std::forward_list<Args...>;
+
+            // A node can only be unlinked from a forward_list through
+            // its predecessor, so every node is detached in its own
+            // list, and pointers to these lists are sorted: the lists
+            // stay where they are, so that the nodes can be given back
+            // to the collection if anything throws
+            std::vector<flist_t> nodes;
+            nodes.reserve(utility::size(collection));
+            while (not collection.empty()) {
+                nodes.emplace_back(collection.get_allocator());
+                nodes.back().splice_after(nodes.back().before_begin(),
+                                          collection, collection.before_begin());
+            }
+
+            try {
+                std::vector<flist_t*> handles;
+                handles.reserve(nodes.size());
+                for (auto& node: nodes) {
+                    handles.push_back(&node);
+                }
+
+                return sort_and_relink(
+                    sorter, handles, std::move(compare),
+                    flist_node_projection<Projection>{std::move(projection)},
+                    [&collection, &handles] {
+                        auto tail = collection.before_begin();
+                        for (auto node: handles) {
+                            collection.splice_after(tail, *node);
+                            ++tail;
+                        }
+                    }
+                );
+            } catch (...) {
+                // Relink the nodes in their original order
+                auto tail = collection.before_begin();
+                while (std::next(tail) != collection.end()) {
+                    ++tail;
+                }
+                for (auto& node: nodes) {
+                    if (not node.empty()) {
+                        collection.splice_after(tail, node);
+                        ++tail;
+                    }
+                }
+                throw;
+            }
+        }
+    }
+
+    template<typename Sorter>
+    struct container_aware_adapter<out_of_place_adapter<Sorter>>:
+        detail::container_aware_adapter_base<out_of_place_adapter<Sorter>>,
+        detail::sorter_facade_fptr<
+            container_aware_adapter<out_of_place_adapter<Sorter>>,
+            std::is_empty<out_of_place_adapter<Sorter>>::value
+        >
+    {
+        using detail::container_aware_adapter_base<out_of_place_adapter<Sorter>>::operator();
+
+        container_aware_adapter() = default;
+
+        constexpr explicit container_aware_adapter(out_of_place_adapter<Sorter> sorter):
+            detail::container_aware_adapter_base<out_of_place_adapter<Sorter>>(std::move(sorter))
+        {}
+
+        ////////////////////////////////////////////////////////////
+        // std::list
+
+        template<typename... Args>
+        auto operator()(std::list<Args...>& iterable) const
+            -> decltype(auto)
+        {
+            return detail::list_relink_sort(this->get().get(), iterable,
+                                            std::less<>{}, utility::identity{});
+        }
+
+        template<typename Compare, typename... Args>
+        auto operator()(std::list<Args...>& iterable, Compare compare) const
+            -> std::enable_if_t<
+                is_projection_v<utility::identity, std::list<Args...>, Compare>,
+                detail::list_relink_sort_result_t<Sorter, std::list<Args...>, Compare, utility::identity>
+            >
+        {
+            return detail::list_relink_sort(this->get().get(), iterable,
+                                            std::move(compare), utility::identity{});
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::list<Args...>& iterable, Projection projection) const
+            -> std::enable_if_t<
+                is_projection_v<Projection, std::list<Args...>>,
+                detail::list_relink_sort_result_t<Sorter, std::list<Args...>, std::less<>, Projection>
+            >
+        {
+            return detail::list_relink_sort(this->get().get(), iterable,
+                                            std::less<>{}, std::move(projection));
+        }
+
+        template<
+            typename Compare,
+            typename Projection,
+            typename... Args,
+            typename = std::enable_if_t<
+                is_projection_v<Projection, std::list<Args...>, Compare>
+            >
+        >
+        auto operator()(std::list<Args...>& iterable,
+                        Compare compare, Projection projection) const
+            -> decltype(auto)
+        {
+            return detail::list_relink_sort(this->get().get(), iterable,
+                                            std::move(compare), std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // std::forward_list
+
+        template<typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable) const
+            -> decltype(auto)
+        {
+            return detail::flist_relink_sort(this->get().get(), iterable,
+                                             std::less<>{}, utility::identity{});
+        }
+
+        template<typename Compare, typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable, Compare compare) const
+            -> std::enable_if_t<
+                is_projection_v<utility::identity, std::forward_list<Args...>, Compare>,
+                detail::flist_relink_sort_result_t<Sorter, std::forward_list<Args...>, Compare, utility::identity>
+            >
+        {
+            return detail::flist_relink_sort(this->get().get(), iterable,
+                                             std::move(compare), utility::identity{});
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable, Projection projection) const
+            -> std::enable_if_t<
+                is_projection_v<Projection, std::forward_list<Args...>>,
+                detail::flist_relink_sort_result_t<Sorter, std::forward_list<Args...>, std::less<>, Projection>
+            >
+        {
+            return detail::flist_relink_sort(this->get().get(), iterable,
+                                             std::less<>{}, std::move(projection));
+        }
+
+        template<
+            typename Compare,
+            typename Projection,
+            typename... Args,
+            typename = std::enable_if_t<
+                is_projection_v<Projection, std::forward_list<Args...>, Compare>
+            >
+        >
+        auto operator()(std::forward_list<Args...>& iterable,
+                        Compare compare, Projection projection) const
+            -> decltype(auto)
+        {
+            return detail::flist_relink_sort(this->get().get(), iterable,
+                                             std::move(compare), std::move(projection));
+        }
+    };
+}
+
+#endif // CPPSORT_DETAIL_CONTAINER_AWARE_OUT_OF_PLACE_H_
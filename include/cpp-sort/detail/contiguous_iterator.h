@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTIGUOUS_ITERATOR_H_
+#define CPPSORT_DETAIL_CONTIGUOUS_ITERATOR_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <array>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "iterator_traits.h"
+#include "type_traits.h"
+
+#if __cplusplus > 201703L && __has_include(<concepts>)
+#   include <concepts>
+#endif
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Detect the iterators of the standard library's contiguous
+    // containers: before C++20 there is no generic way to know
+    // whether an iterator is contiguous
+
+    template<typename Iterator, typename Value>
+    struct is_standard_contiguous_iterator_impl:
+        disjunction<
+            std::is_same<Iterator, typename std::vector<Value>::iterator>,
+            std::is_same<Iterator, typename std::vector<Value>::const_iterator>,
+            std::is_same<Iterator, typename std::array<Value, 1>::iterator>,
+            std::is_same<Iterator, typename std::array<Value, 1>::const_iterator>,
+            std::is_same<Iterator, std::string::iterator>,
+            std::is_same<Iterator, std::string::const_iterator>,
+            std::is_same<Iterator, std::wstring::iterator>,
+            std::is_same<Iterator, std::wstring::const_iterator>,
+            std::is_same<Iterator, std::u16string::iterator>,
+            std::is_same<Iterator, std::u16string::const_iterator>,
+            std::is_same<Iterator, std::u32string::iterator>,
+            std::is_same<Iterator, std::u32string::const_iterator>
+        >
+    {};
+
+    template<typename Iterator, typename = void>
+    struct is_standard_contiguous_iterator:
+        std::false_type
+    {};
+
+    template<typename Iterator>
+    struct is_standard_contiguous_iterator<Iterator, void_t<value_type_t<Iterator>>>:
+        conditional_t<
+            // std::vector<bool> is not contiguous, and naming the
+            // iterators of a container of other types is ill-formed
+            std::is_object<value_type_t<Iterator>>::value &&
+            not std::is_array<value_type_t<Iterator>>::value &&
+            not std::is_abstract<value_type_t<Iterator>>::value &&
+            not std::is_same<value_type_t<Iterator>, bool>::value,
+            is_standard_contiguous_iterator_impl<Iterator, value_type_t<Iterator>>,
+            std::false_type
+        >
+    {};
+
+    template<typename Iterator>
+    struct is_contiguous_iterator:
+#if defined(__cpp_lib_concepts)
+        std::integral_constant<bool, std::contiguous_iterator<Iterator>>
+#else
+        disjunction<
+            std::is_pointer<Iterator>,
+            is_standard_contiguous_iterator<Iterator>
+        >
+#endif
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Call a sorter with raw pointers instead of contiguous
+    // iterators: the detail algorithms can then use their fast
+    // paths for pointers, and wrapped iterators don't pay for
+    // additional checks in debug modes. The iterators are only
+    // unwrapped when the sorter accepts pointers and returns the
+    // same thing when it does
+
+    template<typename Iterator>
+    using unwrapped_pointer_t = std::add_pointer_t<std::remove_reference_t<reference_t<Iterator>>>;
+
+    template<typename Sorter, typename Iterator, typename... Args>
+    struct can_unwrap_impl:
+        conjunction<
+            is_invocable<const Sorter&, unwrapped_pointer_t<Iterator>,
+                         unwrapped_pointer_t<Iterator>, Args...>,
+            std::is_same<
+                invoke_result_t<const Sorter&, unwrapped_pointer_t<Iterator>,
+                                unwrapped_pointer_t<Iterator>, Args...>,
+                invoke_result_t<const Sorter&, Iterator, Iterator, Args...>
+            >
+        >
+    {};
+
+    template<typename Sorter, typename Iterator, typename... Args>
+    struct can_unwrap:
+        conditional_t<
+            not std::is_pointer<Iterator>::value &&
+            is_contiguous_iterator<Iterator>::value &&
+            std::is_lvalue_reference<reference_t<Iterator>>::value,
+            can_unwrap_impl<Sorter, Iterator, Args...>,
+            std::false_type
+        >
+    {};
+
+    template<typename Sorter, typename Iterator, typename... Args>
+    auto invoke_unwrapped(std::false_type, const Sorter& sorter,
+                          Iterator first, Iterator last, Args&&... args)
+        -> decltype(sorter(std::move(first), std::move(last), std::forward<Args>(args)...))
+    {
+        return sorter(std::move(first), std::move(last), std::forward<Args>(args)...);
+    }
+
+    template<typename Sorter, typename Iterator, typename... Args>
+    auto invoke_unwrapped(std::true_type, const Sorter& sorter,
+                          Iterator first, Iterator last, Args&&... args)
+        -> decltype(sorter(std::move(first), std::move(last), std::forward<Args>(args)...))
+    {
+        if (first == last) {
+            // Can't dereference the iterators of an empty range
+            return sorter(std::move(first), std::move(last), std::forward<Args>(args)...);
+        }
+        auto ptr = std::addressof(*first);
+        return sorter(ptr, ptr + (last - first), std::forward<Args>(args)...);
+    }
+
+    template<typename Sorter, typename Iterator, typename... Args>
+    auto invoke_unwrapped(const Sorter& sorter, Iterator first, Iterator last, Args&&... args)
+        -> decltype(sorter(std::move(first), std::move(last), std::forward<Args>(args)...))
+    {
+        return invoke_unwrapped(can_unwrap<Sorter, Iterator, Args...>{}, sorter,
+                                std::move(first), std::move(last), std::forward<Args>(args)...);
+    }
+}}
+
+#endif // CPPSORT_DETAIL_CONTIGUOUS_ITERATOR_H_
@@ -295,9 +295,7 @@ namespace grail
 
         if (first < middle) {
             auto left_over_len = middle - first;
-            do {
-                *--last = iter_move(--middle);
-            } while (first != middle);
+            detail::move_backward(first, middle, last);
             return { left_over_len, left_over_frag };
         }
         return { (last - it), frag_type };
@@ -313,7 +313,7 @@ namespace detail
             return introselect(first, middle1, nth_pos,
                                size_left, --bad_allowed,
                                std::move(compare), std::move(projection));
-        } else if (nth_pos > size_left + size_middle) {
+        } else if (nth_pos >= size_left + size_middle) {
             return introselect(middle2, last, nth_pos - size_left - size_middle,
                                size_right, --bad_allowed,
                                std::move(compare), std::move(projection));
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_KWAY_MERGE_H_
+#define CPPSORT_DETAIL_KWAY_MERGE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "inplace_merge.h"
+#include "iterator_traits.h"
+#include "memory.h"
+#include "move.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Tournament tree of losers: every internal node remembers
+    // the run which lost the match played there, and the winner
+    // of the whole tournament is the run whose first element is
+    // the smallest. When the winner advances, only the matches on
+    // the path from its leaf to the root are replayed, which takes
+    // exactly ceil(log2(k)) comparisons, about half as many as a
+    // binary heap needs to sift an element down
+    //
+    // Exhausted runs are removed from the tournament, which is then
+    // played again from scratch: it only happens k times, and the
+    // matches don't have to check whether the runs are empty. Ties
+    // are won by the run that comes first, which makes the merge
+    // stable
+
+    template<typename Iterator, typename Compare, typename Projection>
+    class loser_tree
+    {
+        public:
+
+            using run_type = std::pair<Iterator, Iterator>;
+
+            loser_tree(const run_type* first, const run_type* last,
+                       Compare compare, Projection projection):
+                compare(std::move(compare)),
+                projection(std::move(projection))
+            {
+                std::vector<Iterator> heads;
+                for (; first != last ; ++first) {
+                    if (first->first != first->second) {
+                        heads.push_back(first->first);
+                        ends.push_back(first->second);
+                    }
+                }
+                nodes.resize(heads.size());
+                play(heads);
+            }
+
+            // Number of runs which still have elements
+            auto size() const noexcept
+                -> std::size_t
+            {
+                return ends.size();
+            }
+
+            // Remaining elements of the winning run
+            auto top() const
+                -> run_type
+            {
+                return { winner.it, ends[winner.pos] };
+            }
+
+            // Advance the winning run and replay its matches
+            auto pop()
+                -> void
+            {
+                ++winner.it;
+                if (winner.it == ends[winner.pos]) {
+                    remove_winner();
+                } else {
+                    replay(std::integral_constant<bool, is_branchless>{});
+                }
+            }
+
+        private:
+
+            using value_type = value_type_t<Iterator>;
+            using projected_type = projected_t<Iterator, Projection>;
+            static constexpr bool is_branchless =
+                utility::is_probably_branchless_comparison_v<Compare, projected_type> &&
+                utility::is_probably_branchless_projection_v<Projection, value_type>;
+
+            // The nodes directly hold the current position of the runs
+            // which lost there: replaying a match doesn't need to look
+            // for it elsewhere
+            struct node_type
+            {
+                Iterator it;
+                std::size_t pos;
+            };
+
+            auto replay(std::false_type /* branchless */)
+                -> void
+            {
+                std::size_t nb_runs = ends.size();
+                for (std::size_t node = (winner.pos + nb_runs) / 2 ; node > 0 ; node /= 2) {
+                    if (beats(nodes[node], winner)) {
+                        std::swap(nodes[node], winner);
+                    }
+                }
+            }
+
+            // The outcome of the matches is hard to predict, when the
+            // comparison is cheap it is better to compute it without
+            // branches and to select the new winner with conditional
+            // moves
+            auto replay(std::true_type /* branchless */)
+                -> void
+            {
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                std::size_t nb_runs = ends.size();
+                for (std::size_t node = (winner.pos + nb_runs) / 2 ; node > 0 ; node /= 2) {
+                    node_type loser = nodes[node];
+                    auto&& loser_value = proj(*loser.it);
+                    auto&& winner_value = proj(*winner.it);
+                    bool loser_wins = comp(loser_value, winner_value)
+                                    | (not comp(winner_value, loser_value) & (loser.pos < winner.pos));
+                    nodes[node] = loser_wins ? winner : loser;
+                    winner = loser_wins ? loser : winner;
+                }
+            }
+
+            // Remove an exhausted run, the other runs are all held by
+            // the internal nodes, one per node
+            auto remove_winner()
+                -> void
+            {
+                std::size_t nb_runs = ends.size();
+                std::vector<Iterator> heads(nb_runs);
+                for (std::size_t node = 1 ; node < nb_runs ; ++node) {
+                    heads[nodes[node].pos] = nodes[node].it;
+                }
+                heads.erase(heads.begin() + winner.pos);
+                ends.erase(ends.begin() + winner.pos);
+                play(heads);
+            }
+
+            // Play the whole tournament: the leaves are the nodes
+            // [k, 2k) of a binary heap layout
+            auto play(const std::vector<Iterator>& heads)
+                -> void
+            {
+                std::size_t nb_runs = heads.size();
+                if (nb_runs == 0) {
+                    return;
+                }
+
+                std::vector<node_type> winners(nb_runs);
+                auto winner_at = [&](std::size_t node) -> node_type {
+                    if (node >= nb_runs) {
+                        return { heads[node - nb_runs], node - nb_runs };
+                    }
+                    return winners[node];
+                };
+                for (std::size_t node = nb_runs - 1 ; node > 0 ; --node) {
+                    node_type lhs = winner_at(2 * node);
+                    node_type rhs = winner_at(2 * node + 1);
+                    if (beats(rhs, lhs)) {
+                        std::swap(lhs, rhs);
+                    }
+                    winners[node] = lhs;
+                    nodes[node] = rhs;
+                }
+                winner = nb_runs > 1 ? winners[1] : node_type{ heads[0], 0 };
+            }
+
+            auto beats(const node_type& lhs, const node_type& rhs)
+                -> bool
+            {
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+                if (lhs.pos < rhs.pos) {
+                    return not comp(proj(*rhs.it), proj(*lhs.it));
+                }
+                return comp(proj(*lhs.it), proj(*rhs.it));
+            }
+
+            // End of the runs which still have elements
+            std::vector<Iterator> ends;
+            // Losers of the matches played at every internal node
+            std::vector<node_type> nodes;
+            node_type winner;
+            Compare compare;
+            Projection projection;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Merge several sorted runs at once into an output iterator,
+    // the elements are copied, or moved when Move is true
+
+    template<typename InputIterator, typename OutputIterator>
+    auto kway_transfer(std::false_type /* move */, InputIterator it, OutputIterator& out)
+        -> void
+    {
+        *out = *it;
+        ++out;
+    }
+
+    template<typename InputIterator, typename OutputIterator>
+    auto kway_transfer(std::true_type /* move */, InputIterator it, OutputIterator& out)
+        -> void
+    {
+        using utility::iter_move;
+        *out = iter_move(it);
+        ++out;
+    }
+
+    template<typename InputIterator, typename OutputIterator>
+    auto kway_transfer(std::false_type /* move */, InputIterator first, InputIterator last,
+                       OutputIterator out)
+        -> OutputIterator
+    {
+        for (; first != last ; ++first) {
+            *out = *first;
+            ++out;
+        }
+        return out;
+    }
+
+    template<typename InputIterator, typename OutputIterator>
+    auto kway_transfer(std::true_type /* move */, InputIterator first, InputIterator last,
+                       OutputIterator out)
+        -> OutputIterator
+    {
+        return detail::move(first, last, out);
+    }
+
+    template<bool Move, typename Iterator, typename OutputIterator,
+             typename Compare, typename Projection>
+    auto kway_merge(std::pair<Iterator, Iterator>* runs, std::size_t nb_runs,
+                    OutputIterator out, Compare compare, Projection projection)
+        -> OutputIterator
+    {
+        using move_t = std::integral_constant<bool, Move>;
+
+        loser_tree<Iterator, Compare, Projection> tree(runs, runs + nb_runs,
+                                                       std::move(compare),
+                                                       std::move(projection));
+        while (tree.size() > 1) {
+            kway_transfer(move_t{}, tree.top().first, out);
+            tree.pop();
+        }
+        if (tree.size() == 1) {
+            // Transfer what remains of the last run in bulk
+            auto run = tree.top();
+            out = kway_transfer(move_t{}, run.first, run.second, std::move(out));
+        }
+        return out;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Merge consecutive sorted runs in place: run_ends holds the
+    // end of every run, the first one starting at first. All the
+    // elements are moved to a buffer and merged back in a single
+    // pass, or merged pairwise when the buffer can't be allocated
+
+    template<typename RandomAccessIterator, typename ForwardIterator,
+             typename Compare, typename Projection>
+    auto pairwise_inplace_merge(RandomAccessIterator first,
+                                ForwardIterator ends_first, ForwardIterator ends_last,
+                                Compare compare, Projection projection)
+        -> void
+    {
+        std::vector<RandomAccessIterator> ends(ends_first, ends_last);
+        while (ends.size() > 1) {
+            std::size_t out = 0;
+            auto begin = first;
+            std::size_t idx = 0;
+            for (; idx + 1 < ends.size() ; idx += 2) {
+                detail::inplace_merge(begin, ends[idx], ends[idx + 1], compare, projection);
+                begin = ends[idx + 1];
+                ends[out++] = begin;
+            }
+            if (idx < ends.size()) {
+                ends[out++] = ends[idx];
+            }
+            ends.resize(out);
+        }
+    }
+
+    template<typename RandomAccessIterator, typename ForwardIterator,
+             typename Compare, typename Projection>
+    auto kway_inplace_merge(RandomAccessIterator first,
+                            ForwardIterator ends_first, ForwardIterator ends_last,
+                            Compare compare, Projection projection)
+        -> void
+    {
+        using rvalue_reference = remove_cvref_t<rvalue_reference_t<RandomAccessIterator>>;
+
+        auto nb_runs = static_cast<std::size_t>(std::distance(ends_first, ends_last));
+        if (nb_runs < 2) {
+            return;
+        }
+        auto last = *std::next(ends_first, nb_runs - 1);
+        if (nb_runs == 2) {
+            detail::inplace_merge(first, *ends_first, last,
+                                  std::move(compare), std::move(projection));
+            return;
+        }
+
+        auto size = last - first;
+        temporary_buffer<rvalue_reference> buffer(size);
+        if (buffer.size() < size) {
+            pairwise_inplace_merge(first, ends_first, ends_last,
+                                   std::move(compare), std::move(projection));
+            return;
+        }
+
+        destruct_n<rvalue_reference> d(0);
+        std::unique_ptr<rvalue_reference, destruct_n<rvalue_reference>&> h2(buffer.data(), d);
+        detail::uninitialized_move(first, last, buffer.data(), d);
+
+        std::vector<std::pair<rvalue_reference*, rvalue_reference*>> runs;
+        runs.reserve(nb_runs);
+        auto run_begin = first;
+        for (auto it = ends_first ; it != ends_last ; ++it) {
+            auto run_end = *it;
+            runs.emplace_back(buffer.data() + (run_begin - first),
+                              buffer.data() + (run_end - first));
+            run_begin = run_end;
+        }
+
+        kway_merge<true>(runs.data(), runs.size(), first,
+                         std::move(compare), std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_DETAIL_KWAY_MERGE_H_
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_LCP_MERGE_SORT_H_
+#define CPPSORT_DETAIL_LCP_MERGE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "insertion_sort.h"
+#include "iterator_traits.h"
+#include "memory.h"
+#include "move.h"
+#include "string_key.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    //
+    // LCP-mergesort, as described by Ng and Kakehi in "Merging
+    // String Sequences by Longest Common Prefixes": a top-down
+    // stable mergesort where every element is stored alongside
+    // the length of its longest common prefix with the previous
+    // element of its run. When merging two runs, the LCPs of both
+    // run heads with the last element written are known, and the
+    // strings only need to be compared when both LCPs are equal,
+    // starting after the common prefix.
+    //
+    // The algorithm computes the full LCP array of the sorted
+    // sequence: lcp[i] is the length of the longest common prefix
+    // of the elements i-1 and i after the sort, and lcp[0] == 0.
+    //
+
+    namespace lcp_merge_detail
+    {
+        enum {
+            // Partitions below this size are sorted with insertion sort
+            insertion_sort_threshold = 16
+        };
+
+        // Whether lhs should come before rhs in the sorted sequence,
+        // knowing that their LCP is lcp; equivalent strings return
+        // true so that the merge remains stable
+        template<bool Reversed, typename String1, typename String2>
+        auto goes_first(const String1& lhs, const String2& rhs, std::size_t lcp)
+            -> bool
+        {
+            if (lcp == lhs.size()) {
+                return Reversed ? lcp == rhs.size() : true;
+            }
+            if (lcp == rhs.size()) {
+                return Reversed;
+            }
+            auto lhs_rank = char_rank(lhs[lcp]);
+            auto rhs_rank = char_rank(rhs[lcp]);
+            return Reversed ? rhs_rank < lhs_rank : lhs_rank < rhs_rank;
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection>
+        auto small_sort(RandomAccessIterator first, RandomAccessIterator last,
+                        std::size_t* lcp, Projection projection)
+            -> void
+        {
+            auto&& proj = utility::as_function(projection);
+
+            auto compare = [](const auto& lhs, const auto& rhs) {
+                int res = compare_from(lhs, rhs, 0);
+                return Reversed ? res > 0 : res < 0;
+            };
+            insertion_sort(first, last, compare, projection);
+
+            lcp[0] = 0;
+            for (std::ptrdiff_t i = 1 ; i < last - first ; ++i) {
+                lcp[i] = lcp_from(proj(first[i - 1]), proj(first[i]), 0);
+            }
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename T, typename Projection>
+        auto lcp_merge(RandomAccessIterator first, RandomAccessIterator middle,
+                       RandomAccessIterator last, std::size_t* lcp,
+                       T* buffer, std::size_t* lcp_buffer,
+                       Projection projection)
+            -> void
+        {
+            using utility::iter_move;
+            auto&& proj = utility::as_function(projection);
+
+            // Move the left run and its LCPs to the buffer
+            destruct_n<T> d(0);
+            std::unique_ptr<T, destruct_n<T>&> h2(buffer, d);
+            auto buffer_end = uninitialized_move(first, middle, buffer, d);
+            std::copy(lcp, lcp + (middle - first), lcp_buffer);
+
+            // LCPs of the heads of the runs with the last element
+            // written to the output, conceptually an empty string
+            // at the beginning of the merge
+            std::size_t lcp_left = 0;
+            std::size_t lcp_right = 0;
+
+            auto left = buffer;
+            auto right = middle;
+            auto out = first;
+            std::size_t* lcp_left_it = lcp_buffer;
+            std::size_t* lcp_out = lcp;
+            while (left != buffer_end) {
+                if (right == last) {
+                    // Move the rest of the left run, the first element
+                    // being the only one whose LCP changed
+                    *lcp_out = lcp_left;
+                    std::copy(lcp_left_it + 1, lcp_left_it + (buffer_end - left), lcp_out + 1);
+                    detail::move(left, buffer_end, out);
+                    return;
+                }
+
+                bool take_left;
+                if (lcp_left > lcp_right) {
+                    take_left = true;
+                } else if (lcp_left < lcp_right) {
+                    take_left = false;
+                } else {
+                    auto&& left_proj = proj(*left);
+                    auto&& right_proj = proj(*right);
+                    std::size_t common = lcp_from(left_proj, right_proj, lcp_left);
+                    take_left = goes_first<Reversed>(left_proj, right_proj, common);
+                    if (take_left) {
+                        lcp_right = common;
+                    } else {
+                        lcp_left = common;
+                    }
+                }
+
+                if (take_left) {
+                    *out = iter_move(left);
+                    *lcp_out = lcp_left;
+                    ++left;
+                    ++lcp_left_it;
+                    lcp_left = left == buffer_end ? 0 : *lcp_left_it;
+                } else {
+                    *out = iter_move(right);
+                    *lcp_out = lcp_right;
+                    ++right;
+                    // lcp_out always lags behind the right run, so
+                    // this LCP was not overwritten yet
+                    lcp_right = right == last ? 0 : lcp[right - first];
+                }
+                ++out;
+                ++lcp_out;
+            }
+
+            // The rest of the right run is already in place, only
+            // its first LCP needs to be fixed
+            if (right != last) {
+                *lcp_out = lcp_right;
+            }
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename T, typename Projection>
+        auto lcp_merge_sort_impl(RandomAccessIterator first, RandomAccessIterator last,
+                                 std::size_t* lcp, T* buffer, std::size_t* lcp_buffer,
+                                 Projection projection)
+            -> void
+        {
+            auto&& proj = utility::as_function(projection);
+
+            auto size = last - first;
+            if (size < insertion_sort_threshold) {
+                small_sort<Reversed>(first, last, lcp, projection);
+                return;
+            }
+
+            // Recursively sort both halves
+            auto size_left = size / 2;
+            auto middle = first + size_left;
+            lcp_merge_sort_impl<Reversed>(first, middle, lcp, buffer, lcp_buffer, projection);
+            lcp_merge_sort_impl<Reversed>(middle, last, lcp + size_left, buffer, lcp_buffer, projection);
+
+            // Don't merge runs that are already in order
+            auto&& last_left = proj(*std::prev(middle));
+            auto&& first_right = proj(*middle);
+            std::size_t common = lcp_from(last_left, first_right, 0);
+            if (goes_first<Reversed>(last_left, first_right, common)) {
+                lcp[size_left] = common;
+                return;
+            }
+
+            lcp_merge<Reversed>(first, middle, last, lcp, buffer, lcp_buffer, projection);
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection>
+        auto lcp_merge_sort(RandomAccessIterator first, RandomAccessIterator last,
+                            std::size_t* lcp, Projection projection)
+            -> void
+        {
+            using rvalue_type = remove_cvref_t<rvalue_reference_t<RandomAccessIterator>>;
+
+            auto size = last - first;
+            if (size < insertion_sort_threshold) {
+                if (size > 0) {
+                    small_sort<Reversed>(std::move(first), std::move(last),
+                                         lcp, std::move(projection));
+                }
+                return;
+            }
+
+            // The buffer only ever holds the left run of a merge
+            auto buffer_size = size / 2;
+            std::unique_ptr<rvalue_type, operator_deleter> buffer(
+                static_cast<rvalue_type*>(::operator new(buffer_size * sizeof(rvalue_type))),
+                operator_deleter(buffer_size * sizeof(rvalue_type))
+            );
+            std::unique_ptr<std::size_t[]> lcp_buffer(new std::size_t[buffer_size]);
+
+            lcp_merge_sort_impl<Reversed>(std::move(first), std::move(last),
+                                          lcp, buffer.get(), lcp_buffer.get(),
+                                          std::move(projection));
+        }
+    }
+
+    template<bool Reversed, typename RandomAccessIterator, typename Projection>
+    auto lcp_merge_sort(RandomAccessIterator first, RandomAccessIterator last,
+                        Projection projection)
+        -> void
+    {
+        auto size = last - first;
+        if (size < 2) {
+            return;
+        }
+        std::unique_ptr<std::size_t[]> lcp(new std::size_t[size]);
+        lcp_merge_detail::lcp_merge_sort<Reversed>(std::move(first), std::move(last),
+                                                   lcp.get(), std::move(projection));
+    }
+
+    template<bool Reversed, typename RandomAccessIterator,
+             typename OutputIterator, typename Projection>
+    auto lcp_merge_sort(RandomAccessIterator first, RandomAccessIterator last,
+                        OutputIterator lcp, Projection projection)
+        -> OutputIterator
+    {
+        auto size = last - first;
+        if (size == 0) {
+            return lcp;
+        }
+        std::unique_ptr<std::size_t[]> lcp_array(new std::size_t[size]);
+        lcp_merge_detail::lcp_merge_sort<Reversed>(std::move(first), std::move(last),
+                                                   lcp_array.get(), std::move(projection));
+        return std::copy(lcp_array.get(), lcp_array.get() + size, std::move(lcp));
+    }
+}}
+
+#endif // CPPSORT_DETAIL_LCP_MERGE_SORT_H_
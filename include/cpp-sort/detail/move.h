@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Morwenn
+ * Copyright (c) 2019-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_DETAIL_MOVE_H_
@@ -105,6 +105,34 @@ namespace detail
         return result;
     }
 
+    ////////////////////////////////////////////////////////////
+    // Moving through reverse iterators is the same as moving the
+    // underlying elements in the other direction, which allows the
+    // standard library to perform bulk moves for trivially copyable
+    // types when the underlying iterators are pointers
+
+    template<typename InputIterator, typename OutputIterator>
+    auto move(std::reverse_iterator<InputIterator> first,
+              std::reverse_iterator<InputIterator> last,
+              std::reverse_iterator<OutputIterator> result)
+        -> std::reverse_iterator<OutputIterator>
+    {
+        return std::reverse_iterator<OutputIterator>(
+            detail::move_backward(last.base(), first.base(), result.base())
+        );
+    }
+
+    template<typename InputIterator, typename OutputIterator>
+    auto move_backward(std::reverse_iterator<InputIterator> first,
+                       std::reverse_iterator<InputIterator> last,
+                       std::reverse_iterator<OutputIterator> result)
+        -> std::reverse_iterator<OutputIterator>
+    {
+        return std::reverse_iterator<OutputIterator>(
+            detail::move(last.base(), first.base(), result.base())
+        );
+    }
+
     ////////////////////////////////////////////////////////////
     // uninitialized_move
 
@@ -132,9 +160,12 @@ namespace detail
     auto uninitialized_move(InputIterator first, InputIterator last, T* result, destruct_n<T>& destroyer)
         -> T*
     {
+        // Trivially copyable objects can be copied to uninitialized
+        // memory, in which case a bulk copy can be performed
         using truth_type = std::integral_constant<bool,
-            std::is_trivial<value_type_t<InputIterator>>::value &&
-            std::is_trivial<T>::value
+            std::is_same<remove_cvref_t<rvalue_reference_t<InputIterator>>, T>::value &&
+            std::is_trivially_copyable<T>::value &&
+            std::is_trivially_move_assignable<T>::value
         >;
         return uninitialized_move_impl(truth_type{}, std::move(first), std::move(last),
                                        std::move(result), destroyer);
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_MULTIKEY_QUICKSORT_H_
+#define CPPSORT_DETAIL_MULTIKEY_QUICKSORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "bitops.h"
+#include "insertion_sort.h"
+#include "iterator_traits.h"
+#include "pdqsort.h"
+#include "string_key.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    //
+    // Multikey quicksort, also known as three-way radix quicksort,
+    // as described by Bentley and Sedgewick in "Fast Algorithms for
+    // Sorting and Searching Strings": partitions are made according
+    // to the character at the current depth of the strings and the
+    // depth is only incremented in the partition equal to the pivot,
+    // so that the common prefixes are never scanned twice.
+    //
+    // Several consecutive characters are packed into a 64-bit key
+    // which is cached alongside the elements and computed once per
+    // depth, which avoids most of the indirections during the
+    // partitioning step. Each character is stored with its rank
+    // plus one so that 0 can mark the end of the string, which
+    // keeps the algorithm correct for strings containing nulls.
+    //
+    // The string comparisons of three_way_compare.h are not used:
+    // they always start from the first character, which would scan
+    // the common prefixes again. Partitioning only compares the
+    // cached keys, and the small partitions are sorted with
+    // compare_from, a three-way comparison that starts at the
+    // current depth.
+    //
+    // When requested, the algorithm also computes an array lcp such
+    // as lcp[i] is the length of the longest common prefix of the
+    // elements i-1 and i after the sort, and lcp[0] == 0.
+    //
+
+    namespace mkqs_detail
+    {
+        enum {
+            // Partitions below this size are sorted using insertion sort
+            insertion_sort_threshold = 16,
+
+            // Partitions above this size use Tukey's ninther to select the pivot
+            ninther_threshold = 128
+        };
+
+        template<typename String>
+        constexpr auto bits_per_char()
+            -> unsigned
+        {
+            return CHAR_BIT * sizeof(typename String::value_type) + 1;
+        }
+
+        template<typename String>
+        constexpr auto chars_per_key()
+            -> unsigned
+        {
+            return 64 / bits_per_char<String>();
+        }
+
+        template<typename String>
+        auto make_key(const String& str, std::size_t depth)
+            -> std::uint64_t
+        {
+            std::uint64_t key = 0;
+            std::size_t size = str.size();
+            for (unsigned i = 0 ; i < chars_per_key<String>() ; ++i) {
+                key <<= bits_per_char<String>();
+                if (depth + i < size) {
+                    key |= std::uint64_t(char_rank(str[depth + i])) + 1;
+                }
+            }
+            return key;
+        }
+
+        template<typename String>
+        auto is_end_of_string(std::uint64_t key)
+            -> bool
+        {
+            // The last character of the key is an end marker
+            constexpr std::uint64_t mask = (std::uint64_t(1) << bits_per_char<String>()) - 1;
+            return (key & mask) == 0;
+        }
+
+        template<bool Reversed>
+        auto key_before(std::uint64_t lhs, std::uint64_t rhs)
+            -> bool
+        {
+            return Reversed ? rhs < lhs : lhs < rhs;
+        }
+
+        template<bool Reversed>
+        auto median_of_3(std::uint64_t a, std::uint64_t b, std::uint64_t c)
+            -> std::uint64_t
+        {
+            if (key_before<Reversed>(b, a)) std::swap(a, b);
+            if (key_before<Reversed>(c, b)) std::swap(b, c);
+            if (key_before<Reversed>(b, a)) std::swap(a, b);
+            return b;
+        }
+
+        struct discard_lcp
+        {
+            auto operator()(std::ptrdiff_t, std::size_t) const
+                -> void
+            {}
+        };
+
+        template<typename RandomAccessIterator>
+        struct store_lcp
+        {
+            RandomAccessIterator out;
+
+            auto operator()(std::ptrdiff_t pos, std::size_t value) const
+                -> void
+            {
+                out[pos] = value;
+            }
+        };
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection, typename LcpWriter>
+        auto small_sort(RandomAccessIterator first, RandomAccessIterator last,
+                        std::size_t depth, bool use_insertion_sort,
+                        Projection projection, LcpWriter& lcp, std::ptrdiff_t offset)
+            -> void
+        {
+            auto compare = [depth](const auto& lhs, const auto& rhs) {
+                int res = compare_from(lhs, rhs, depth);
+                return Reversed ? res > 0 : res < 0;
+            };
+            if (use_insertion_sort) {
+                insertion_sort(first, last, compare, projection);
+            } else {
+                pdqsort(first, last, compare, projection);
+            }
+
+            // Every element of the partition shares the first depth
+            // characters, which is a lower bound for the LCP
+            for (std::ptrdiff_t pos = offset + 1 ; pos < offset + (last - first) ; ++pos) {
+                lcp(pos, depth);
+            }
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection, typename LcpWriter>
+        auto multikey_quicksort_loop(RandomAccessIterator first, RandomAccessIterator last,
+                                     std::uint64_t* keys, std::size_t depth, bool keys_ready,
+                                     int bad_allowed, Projection projection,
+                                     LcpWriter& lcp, std::ptrdiff_t offset)
+            -> void
+        {
+            using utility::iter_swap;
+            using string_type = projected_t<RandomAccessIterator, Projection>;
+            auto&& proj = utility::as_function(projection);
+
+            while (true) {
+                std::ptrdiff_t size = last - first;
+                if (size < insertion_sort_threshold || bad_allowed <= 0) {
+                    small_sort<Reversed>(first, last, depth, size < insertion_sort_threshold,
+                                         projection, lcp, offset);
+                    return;
+                }
+
+                // Cache the characters at the current depth
+                if (not keys_ready) {
+                    for (std::ptrdiff_t i = 0 ; i < size ; ++i) {
+                        keys[i] = make_key(proj(first[i]), depth);
+                    }
+                }
+
+                // Choose the pivot
+                std::ptrdiff_t half_size = size / 2;
+                std::uint64_t pivot;
+                if (size > ninther_threshold) {
+                    std::ptrdiff_t eighth = size / 8;
+                    pivot = median_of_3<Reversed>(
+                        median_of_3<Reversed>(keys[0], keys[eighth], keys[2 * eighth]),
+                        median_of_3<Reversed>(keys[half_size - eighth], keys[half_size],
+                                              keys[half_size + eighth]),
+                        median_of_3<Reversed>(keys[size - 1 - 2 * eighth], keys[size - 1 - eighth],
+                                              keys[size - 1])
+                    );
+                } else {
+                    pivot = median_of_3<Reversed>(keys[0], keys[half_size], keys[size - 1]);
+                }
+
+                // Dijkstra's three-way partition, moving the keys
+                // alongside the elements
+                std::ptrdiff_t lt = 0;
+                std::ptrdiff_t gt = size;
+                for (std::ptrdiff_t i = 0 ; i < gt ;) {
+                    if (key_before<Reversed>(keys[i], pivot)) {
+                        if (i != lt) {
+                            iter_swap(first + i, first + lt);
+                            std::swap(keys[i], keys[lt]);
+                        }
+                        ++lt;
+                        ++i;
+                    } else if (key_before<Reversed>(pivot, keys[i])) {
+                        --gt;
+                        iter_swap(first + i, first + gt);
+                        std::swap(keys[i], keys[gt]);
+                    } else {
+                        ++i;
+                    }
+                }
+
+                // Elements of different partitions share at least
+                // the current depth characters
+                if (lt > 0) {
+                    lcp(offset + lt, depth);
+                }
+                if (gt < size) {
+                    lcp(offset + gt, depth);
+                }
+
+                // Keep track of unbalanced partitions to avoid the
+                // quadratic worst case of quicksort
+                std::ptrdiff_t largest_side = lt > size - gt ? lt : size - gt;
+                if (largest_side > size - size / 8) {
+                    --bad_allowed;
+                }
+
+                // Sort the equal partition: either all the strings ended
+                // and are equal, or we need to look further in the strings
+                bool ended = is_end_of_string<string_type>(pivot);
+                if (ended) {
+                    std::size_t length = proj(first[lt]).size();
+                    for (std::ptrdiff_t pos = offset + lt + 1 ; pos < offset + gt ; ++pos) {
+                        lcp(pos, length);
+                    }
+                }
+
+                // Recurse into the smaller partitions and loop on the
+                // biggest one to keep the stack depth logarithmic
+                std::ptrdiff_t equal_size = ended ? 0 : gt - lt;
+                std::size_t next_depth = depth + chars_per_key<string_type>();
+                if (equal_size > 0 && equal_size >= lt && equal_size >= size - gt) {
+                    multikey_quicksort_loop<Reversed>(first, first + lt, keys, depth, true,
+                                                      bad_allowed, projection, lcp, offset);
+                    multikey_quicksort_loop<Reversed>(first + gt, last, keys + gt, depth, true,
+                                                      bad_allowed, projection, lcp, offset + gt);
+                    offset += lt;
+                    keys += lt;
+                    last = first + gt;
+                    first += lt;
+                    depth = next_depth;
+                    keys_ready = false;
+                } else {
+                    if (equal_size > 0) {
+                        multikey_quicksort_loop<Reversed>(first + lt, first + gt, keys + lt, next_depth, false,
+                                                          bad_allowed, projection, lcp, offset + lt);
+                    }
+                    if (lt >= size - gt) {
+                        multikey_quicksort_loop<Reversed>(first + gt, last, keys + gt, depth, true,
+                                                          bad_allowed, projection, lcp, offset + gt);
+                        last = first + lt;
+                    } else {
+                        multikey_quicksort_loop<Reversed>(first, first + lt, keys, depth, true,
+                                                          bad_allowed, projection, lcp, offset);
+                        offset += gt;
+                        keys += gt;
+                        first += gt;
+                    }
+                    keys_ready = true;
+                }
+            }
+        }
+
+        template<bool Reversed, typename RandomAccessIterator, typename Projection, typename LcpWriter>
+        auto multikey_quicksort(RandomAccessIterator first, RandomAccessIterator last,
+                                Projection projection, LcpWriter lcp)
+            -> void
+        {
+            auto size = last - first;
+            if (size < 2) {
+                return;
+            }
+
+            std::unique_ptr<std::uint64_t[]> keys(new std::uint64_t[size]);
+            int bad_allowed = static_cast<int>(detail::log2(static_cast<std::size_t>(size)));
+            multikey_quicksort_loop<Reversed>(std::move(first), std::move(last), keys.get(), 0, false,
+                                              bad_allowed, std::move(projection), lcp, 0);
+        }
+    }
+
+    template<bool Reversed, typename RandomAccessIterator, typename Projection>
+    auto multikey_quicksort(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection)
+        -> void
+    {
+        mkqs_detail::multikey_quicksort<Reversed>(std::move(first), std::move(last),
+                                                  std::move(projection),
+                                                  mkqs_detail::discard_lcp{});
+    }
+
+    template<bool Reversed, typename RandomAccessIterator,
+             typename LcpIterator, typename Projection>
+    auto multikey_quicksort(RandomAccessIterator first, RandomAccessIterator last,
+                            LcpIterator lcp, Projection projection)
+        -> LcpIterator
+    {
+        auto&& proj = utility::as_function(projection);
+
+        auto size = last - first;
+        if (size == 0) {
+            return lcp;
+        }
+
+        // Store lower bounds of the LCPs during the sort, then
+        // extend them to the actual values: the bounds are exact
+        // or nearly so, so it only requires a few comparisons
+        mkqs_detail::multikey_quicksort<Reversed>(first, last, projection,
+                                                  mkqs_detail::store_lcp<LcpIterator>{lcp});
+        lcp[0] = 0;
+        for (decltype(size) i = 1 ; i < size ; ++i) {
+            lcp[i] = lcp_from(proj(first[i - 1]), proj(first[i]), lcp[i]);
+        }
+        return lcp + size;
+    }
+}}
+
+#endif // CPPSORT_DETAIL_MULTIKEY_QUICKSORT_H_
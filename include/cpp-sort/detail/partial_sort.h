@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_PARTIAL_SORT_H_
+#define CPPSORT_DETAIL_PARTIAL_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "bitops.h"
+#include "heapsort.h"
+#include "introselect.h"
+#include "iterator_traits.h"
+#include "pdqsort.h"
+#include "ska_sort.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Heap-based partial sort: the k smallest elements are kept
+    // in a max-heap while the rest of the collection is scanned,
+    // most of the scanned elements being rejected with a single
+    // comparison against the top of the heap
+    //
+    // With random data, the number of elements entering the heap
+    // grows logarithmically with the number of scanned elements,
+    // but it grows linearly with patterns such as descending runs.
+    // The algorithm gives up and returns false when too many
+    // elements enter the heap, leaving the collection in an
+    // unspecified order
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto heap_partial_sort(RandomAccessIterator first, RandomAccessIterator middle,
+                           RandomAccessIterator last,
+                           Compare compare, Projection projection)
+        -> bool
+    {
+        using utility::iter_swap;
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        auto len = middle - first;
+        difference_type_t<RandomAccessIterator> nb_pushed = 0;
+        detail::make_heap(first, middle, compare, projection);
+        for (auto it = middle ; it != last ; ++it) {
+            if (comp(proj(*it), proj(*first))) {
+                if (++nb_pushed > 2 * len + 64 + (it - middle) / 4) {
+                    return false;
+                }
+                iter_swap(it, first);
+                sift_down<Compare>(first, middle, compare, projection, len, first);
+            }
+        }
+        detail::sort_heap(first, middle, std::move(compare), std::move(projection));
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sort the selected elements, with a radix sort when the
+    // keys allow it
+
+    template<typename Compare, typename RandomAccessIterator, typename Projection>
+    struct is_partial_sort_radixable:
+        std::integral_constant<bool,
+            std::is_same<Compare, std::less<>>::value &&
+            is_ska_sortable_v<projected_t<RandomAccessIterator, Projection>>
+        >
+    {};
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto sort_selected(std::true_type /* radix */,
+                       RandomAccessIterator first, RandomAccessIterator last,
+                       Compare, Projection projection)
+        -> void
+    {
+        ska_sort(std::move(first), std::move(last), std::move(projection));
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto sort_selected(std::false_type /* radix */,
+                       RandomAccessIterator first, RandomAccessIterator last,
+                       Compare compare, Projection projection)
+        -> void
+    {
+        pdqsort(std::move(first), std::move(last),
+                std::move(compare), std::move(projection));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sort the k smallest elements of a collection at its front,
+    // the order of the other elements is unspecified
+
+    template<typename RandomAccessIterator>
+    constexpr auto partial_sort_heap_limit(difference_type_t<RandomAccessIterator> size)
+        -> difference_type_t<RandomAccessIterator>
+    {
+        // Past this limit, selecting the elements then sorting them
+        // is faster than maintaining the heap
+        return size / 64;
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto partial_sort(RandomAccessIterator first, RandomAccessIterator last,
+                      difference_type_t<RandomAccessIterator> k,
+                      Compare compare, Projection projection)
+        -> RandomAccessIterator
+    {
+        using radix_t = is_partial_sort_radixable<Compare, RandomAccessIterator, Projection>;
+
+        auto size = last - first;
+        if (k <= 0) {
+            return first;
+        }
+        if (k >= size) {
+            sort_selected(radix_t{}, first, last, std::move(compare), std::move(projection));
+            return last;
+        }
+
+        auto middle = first + k;
+        if (k <= partial_sort_heap_limit<RandomAccessIterator>(size) &&
+            heap_partial_sort(first, middle, last, compare, projection)) {
+            return middle;
+        }
+
+        // Introselect guarantees a linear selection even when the
+        // heap gave up because of an adversarial pattern; the k-th
+        // smallest element is then already at its place, there is
+        // no need to sort it again
+        introselect(first, last, k - 1, size, detail::log2(size), compare, projection);
+        sort_selected(radix_t{}, first, middle - 1, std::move(compare), std::move(projection));
+        return middle;
+    }
+}}
+
+#endif // CPPSORT_DETAIL_PARTIAL_SORT_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016 Morwenn
+ * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 
@@ -17,6 +17,8 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -187,6 +189,40 @@ namespace detail
         return rotate_forward(first, middle, last);
     }
 
+    ////////////////////////////////////////////////////////////
+    // Rotation of contiguous trivially copyable elements: when
+    // the smaller side fits in a small stack buffer, it is copied
+    // there, the bigger side is moved in bulk, and the smaller
+    // side is copied back at the other end. Otherwise a block
+    // swap rotation is used, which was measured to be noticeably
+    // faster than a GCD rotation for big collections since it
+    // accesses memory sequentially
+
+    constexpr std::size_t rotate_buffer_bytes = 512;
+
+    template<typename T>
+    auto rotate_impl(T* first, T* middle, T* last, std::random_access_iterator_tag)
+        -> std::enable_if_t<std::is_trivially_copyable<T>::value, T*>
+    {
+        std::size_t len1 = middle - first;
+        std::size_t len2 = last - middle;
+        if ((len1 < len2 ? len1 : len2) * sizeof(T) > rotate_buffer_bytes) {
+            return rotate_forward(first, middle, last);
+        }
+
+        alignas(T) unsigned char buffer[rotate_buffer_bytes];
+        if (len1 <= len2) {
+            std::memcpy(buffer, first, len1 * sizeof(T));
+            std::memmove(first, middle, len2 * sizeof(T));
+            std::memcpy(first + len2, buffer, len1 * sizeof(T));
+        } else {
+            std::memcpy(buffer, middle, len2 * sizeof(T));
+            std::memmove(first + len2, first, len1 * sizeof(T));
+            std::memcpy(first, buffer, len2 * sizeof(T));
+        }
+        return first + len2;
+    }
+
     template<typename ForwardIterator>
     auto rotate(ForwardIterator first, ForwardIterator middle, ForwardIterator last)
         -> ForwardIterator
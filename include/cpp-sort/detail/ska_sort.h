@@ -27,8 +27,8 @@
 #include <cpp-sort/utility/functional.h>
 #include "attributes.h"
 #include "iterator_traits.h"
-#include "memcpy_cast.h"
 #include "pdqsort.h"
+#include "total_order_key.h"
 #include "type_traits.h"
 
 namespace cppsort
@@ -134,7 +134,7 @@ namespace detail
 
 #ifdef __SIZEOF_INT128__
     inline auto to_unsigned_or_bool(__int128_t l)
-        -> unsigned long long
+        -> __uint128_t
     {
         return static_cast<__uint128_t>(l)
              + static_cast<__uint128_t>(__int128_t(1) << (CHAR_BIT * sizeof(__int128_t) - 1));
@@ -150,17 +150,13 @@ namespace detail
     inline auto to_unsigned_or_bool(float f)
         -> std::uint32_t
     {
-        auto u = memcpy_cast<std::uint32_t>(f);
-        std::uint32_t sign_bit = -std::int32_t(u >> 31);
-        return u ^ (sign_bit | 0x80000000);
+        return total_order_key(f);
     }
 
     inline auto to_unsigned_or_bool(double f)
         -> std::uint64_t
     {
-        auto u = memcpy_cast<std::uint64_t>(f);
-        std::uint64_t sign_bit = -std::int64_t(u >> 63);
-        return u ^ (sign_bit | 0x8000000000000000);
+        return total_order_key(f);
     }
 
     template<typename T>
@@ -148,10 +148,7 @@ namespace detail
             viter.push_back(mid);
             for (std::uint32_t i = viter.size() - 1; i != 0; --i) {
                 RandomAccessIterator1 src = viter[i], limit = viter[i - 1];
-                RandomAccessIterator1 dest = src + i;
-                while (src != limit) {
-                    *(--dest) = iter_move(--src);
-                }
+                detail::move_backward(limit, src, src + i);
                 *(viter[i - 1] + (i - 1)) = iter_move(data + (i - 1));
             }
         }
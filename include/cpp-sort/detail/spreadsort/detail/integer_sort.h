@@ -229,6 +229,25 @@ namespace spreadsort
       spreadsort_rec<RandomAccessIter, Div_type, std::uintmax_t, Projection>(
           first, last, bin_cache, 0, bin_sizes, projection);
     }
+
+#ifdef __SIZEOF_INT128__
+    //Holds the bin vector and makes the initial recursive call
+    //Used for 128-bit integers when they don't fit in a std::uintmax_t
+    template<typename RandomAccessIter, typename Div_type, typename Projection>
+    auto integer_sort(RandomAccessIter first, RandomAccessIter last,
+                      Div_type, Projection projection)
+        -> std::enable_if_t<
+            (sizeof(Div_type) > sizeof(std::uintmax_t)) &&
+            sizeof(Div_type) <= sizeof(__uint128_t),
+            void
+        >
+    {
+      std::size_t bin_sizes[1 << max_finishing_splits];
+      std::vector<RandomAccessIter> bin_cache;
+      spreadsort_rec<RandomAccessIter, Div_type, __uint128_t, Projection>(
+          first, last, bin_cache, 0, bin_sizes, projection);
+    }
+#endif
   }
 }}}
 
@@ -31,6 +31,7 @@ Phil Endecott and Frank Gennari
 #include <type_traits>
 #include <vector>
 #include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
 #include "common.h"
 #include "constants.h"
 
@@ -161,6 +162,7 @@ namespace spreadsort
         -> void
     {
       auto&& proj = utility::as_function(projection);
+      using utility::iter_swap;
 
       //This section makes handling of long identical substrings much faster
       //with a mild average performance impact.
@@ -271,6 +273,7 @@ namespace spreadsort
         -> void
     {
       auto&& proj = utility::as_function(projection);
+      using utility::iter_swap;
 
       //This section makes handling of long identical substrings much faster
       //with a mild average performance impact.
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_STRING_KEY_H_
+#define CPPSORT_DETAIL_STRING_KEY_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "type_traits.h"
+
+#if __cplusplus > 201402L && __has_include(<string_view>)
+#   include <string_view>
+#endif
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // String types handled by the character-based string
+    // sorters: standard strings and string views whose order
+    // is the one of std::char_traits
+
+    template<typename CharT>
+    struct is_string_char:
+        disjunction<
+            std::is_same<CharT, char>,
+            std::is_same<CharT, wchar_t>,
+            std::is_same<CharT, char16_t>,
+            std::is_same<CharT, char32_t>
+        >
+    {};
+
+    template<typename T>
+    struct is_string_key:
+        std::false_type
+    {};
+
+    template<typename CharT, typename Allocator>
+    struct is_string_key<std::basic_string<CharT, std::char_traits<CharT>, Allocator>>:
+        is_string_char<CharT>
+    {};
+
+#if __cplusplus > 201402L && __has_include(<string_view>)
+    template<typename CharT>
+    struct is_string_key<std::basic_string_view<CharT, std::char_traits<CharT>>>:
+        is_string_char<CharT>
+    {};
+#endif
+
+    ////////////////////////////////////////////////////////////
+    // Rank of a character: an unsigned integer whose natural
+    // order is the order of std::char_traits<CharT>::lt
+
+    inline auto char_rank(char value)
+        -> std::uint_fast32_t
+    {
+        // std::char_traits<char> compares characters as unsigned char
+        return static_cast<unsigned char>(value);
+    }
+
+    template<typename CharT>
+    auto char_rank(CharT value)
+        -> std::enable_if_t<std::is_signed<CharT>::value, std::uint_fast32_t>
+    {
+        using unsigned_t = std::make_unsigned_t<CharT>;
+        return static_cast<unsigned_t>(
+            static_cast<unsigned_t>(value) ^ (unsigned_t(1) << (CHAR_BIT * sizeof(CharT) - 1))
+        );
+    }
+
+    template<typename CharT>
+    auto char_rank(CharT value)
+        -> std::enable_if_t<not std::is_signed<CharT>::value, std::uint_fast32_t>
+    {
+        return value;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // First characters of a string packed into an integer whose
+    // natural order is consistent with the order of the strings:
+    // if the prefixes of two strings compare unequal, the strings
+    // compare the same way
+
+    template<typename String>
+    constexpr auto chars_per_prefix()
+        -> std::size_t
+    {
+        return sizeof(std::uint64_t) / sizeof(typename String::value_type);
+    }
+
+    template<typename String>
+    auto string_prefix(const String& str)
+        -> std::uint64_t
+    {
+        constexpr std::size_t bits_per_char = CHAR_BIT * sizeof(typename String::value_type);
+
+        std::uint64_t res = 0;
+        std::size_t size = str.size();
+        for (std::size_t i = 0 ; i < chars_per_prefix<String>() ; ++i) {
+            // Missing characters are padded with zeros, which makes
+            // shorter strings compare lower or equal
+            res <<= bits_per_char;
+            if (i < size) {
+                res |= char_rank(str[i]);
+            }
+        }
+        return res;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Comparison and longest common prefix of two strings whose
+    // first depth characters are already known to be equal
+
+    template<typename String1, typename String2>
+    auto compare_from(const String1& lhs, const String2& rhs, std::size_t depth)
+        -> int
+    {
+        std::size_t lhs_size = lhs.size();
+        std::size_t rhs_size = rhs.size();
+        for (;; ++depth) {
+            if (depth == lhs_size) {
+                return depth == rhs_size ? 0 : -1;
+            }
+            if (depth == rhs_size) {
+                return 1;
+            }
+            auto lhs_rank = char_rank(lhs[depth]);
+            auto rhs_rank = char_rank(rhs[depth]);
+            if (lhs_rank != rhs_rank) {
+                return lhs_rank < rhs_rank ? -1 : 1;
+            }
+        }
+    }
+
+    template<typename String1, typename String2>
+    auto lcp_from(const String1& lhs, const String2& rhs, std::size_t depth)
+        -> std::size_t
+    {
+        std::size_t size = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+        while (depth < size && lhs[depth] == rhs[depth]) {
+            ++depth;
+        }
+        return depth;
+    }
+}}
+
+#endif // CPPSORT_DETAIL_STRING_KEY_H_
@@ -62,6 +62,8 @@ namespace detail
 
         Iterator base;
         difference_type len;
+        // Power of the boundary between this run and the next one
+        int power = 0;
 
         run(Iterator base, difference_type len):
             base(std::move(base)),
@@ -119,8 +121,8 @@ namespace detail
                     runLen = force;
                 }
 
+                ts.mergeCollapse(cur - lo, runLen, hi - lo, compare, projection);
                 ts.pushRun(cur, runLen);
-                ts.mergeCollapse(compare, projection);
 
                 cur += runLen;
                 nRemaining -= runLen;
@@ -149,9 +151,7 @@ namespace detail
                 auto pivot = iter_move(start);
 
                 iterator const pos = upper_bound(lo, start, proj(pivot), compare, projection);
-                for (iterator p = start; p > pos; --p) {
-                    *p = iter_move(std::prev(p));
-                }
+                detail::move_backward(pos, start, std::next(start));
                 *pos = std::move(pivot);
             }
         }
@@ -202,26 +202,63 @@ namespace detail
             pending_.emplace_back(runBase, runLen);
         }
 
-        auto mergeCollapse(Compare compare, Projection projection)
-            -> void
+        // Powersort merge policy, as described in *Nearly-Optimal
+        // Mergesorts: Fast, Practical Sorting Methods That Optimally
+        // Adapt to Existing Runs* by J. Ian Munro and Sebastian Wild:
+        // the boundary between two consecutive runs is given a power,
+        // the depth of the node holding it in the binary tree obtained
+        // by recursively halving [0, n). Merging the runs in order of
+        // decreasing power gives a merge tree whose cost is within
+        // O(n) of the optimal one, which matters when the run lengths
+        // are very unbalanced
+        static auto nodePower(difference_type s1, difference_type n1,
+                              difference_type n2, difference_type n)
+            -> int
         {
-            while (pending_.size() > 1) {
-                difference_type n = pending_.size() - 2;
-
-                if ((n > 0 && pending_[n - 1].len <= pending_[n].len + pending_[n + 1].len)
-                    || (n > 1 && pending_[n - 2].len <= pending_[n - 1].len + pending_[n].len)){
-                    if (pending_[n - 1].len < pending_[n + 1].len) {
-                        --n;
-                    }
-                    mergeAt(n, compare, projection);
-                }
-                else if (pending_[n].len <= pending_[n + 1].len) {
-                    mergeAt(n, compare, projection);
-                }
-                else {
+            CPPSORT_ASSERT(s1 >= 0);
+            CPPSORT_ASSERT(n1 > 0 && n2 > 0);
+            CPPSORT_ASSERT(s1 + n1 + n2 <= n);
+
+            // Compare the midpoints of the runs, 2*s1 + n1 and
+            // 2*s2 + n2, scaled by 2n, one bit at a time until they
+            // differ: the number of bits consumed is the power
+            difference_type a = 2 * s1 + n1;
+            difference_type b = a + n1 + n2;
+            int result = 0;
+            for (;;) {
+                ++result;
+                if (a >= n) {
+                    CPPSORT_ASSERT(b >= a);
+                    a -= n;
+                    b -= n;
+                } else if (b >= n) {
                     break;
                 }
+                CPPSORT_ASSERT(a < b && b < n);
+                a <<= 1;
+                b <<= 1;
+            }
+            return result;
+        }
+
+        // Called when a new run of length n2 starting at the offset
+        // s2 is found, before it is pushed on the stack: the runs
+        // whose right boundary has a power greater than that of the
+        // boundary between the top run and the new one are merged
+        auto mergeCollapse(difference_type s2, difference_type n2, difference_type n,
+                           Compare compare, Projection projection)
+            -> void
+        {
+            if (pending_.empty()) {
+                return;
+            }
+
+            difference_type const n1 = pending_.back().len;
+            int const power = nodePower(s2 - n1, n1, n2, n);
+            while (pending_.size() > 1 && pending_[pending_.size() - 2].power > power) {
+                mergeAt(pending_.size() - 2, compare, projection);
             }
+            pending_.back().power = power;
         }
 
         auto mergeForceCollapse(Compare compare, Projection projection)
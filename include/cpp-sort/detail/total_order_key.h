@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_TOTAL_ORDER_KEY_H_
+#define CPPSORT_DETAIL_TOTAL_ORDER_KEY_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <cpp-sort/utility/functional.h>
+#include "memcpy_cast.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Unsigned integer keys for IEEE 754 floating point types
+    //
+    // The bits of the floating point number are reinterpreted
+    // as an unsigned integer of the same size: the sign bit is
+    // flipped for positive numbers and every bit is flipped for
+    // negative numbers. The natural order of the resulting keys
+    // is exactly IEEE 754 totalOrder, including the ordering of
+    // signed zeros and NaN payloads, which makes them suitable
+    // for radix sorts that want to honour total_less
+
+    inline auto total_order_key(float value)
+        -> std::uint32_t
+    {
+        static_assert(sizeof(float) == sizeof(std::uint32_t), "");
+        auto u = memcpy_cast<std::uint32_t>(value);
+        std::uint32_t sign_bit = -std::int32_t(u >> 31);
+        return u ^ (sign_bit | 0x80000000);
+    }
+
+    inline auto total_order_key(double value)
+        -> std::uint64_t
+    {
+        static_assert(sizeof(double) == sizeof(std::uint64_t), "");
+        auto u = memcpy_cast<std::uint64_t>(value);
+        std::uint64_t sign_bit = -std::int64_t(u >> 63);
+        return u ^ (sign_bit | 0x8000000000000000);
+    }
+
+    template<typename T>
+    struct has_total_order_key:
+        std::integral_constant<bool,
+            std::numeric_limits<T>::is_iec559 && (
+                sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t)
+            )
+        >
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Projections to the keys, the reversed ones order the keys
+    // according to total_greater instead of total_less
+
+    template<bool Reversed>
+    struct total_order_key_fn:
+        utility::projection_base
+    {
+        template<typename T>
+        auto operator()(T value) const
+            -> decltype(total_order_key(value))
+        {
+            return Reversed ? ~total_order_key(value) : total_order_key(value);
+        }
+    };
+}}
+
+#endif // CPPSORT_DETAIL_TOTAL_ORDER_KEY_H_
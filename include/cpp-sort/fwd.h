@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019 Morwenn
+ * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_FWD_H_
@@ -65,6 +65,12 @@ namespace cppsort
     ////////////////////////////////////////////////////////////
     // Sorter adapters
 
+    template<
+        typename Sorter,
+        std::size_t IndirectThreshold = 256,
+        std::size_t RadixThreshold = 192
+    >
+    struct auto_indirect_adapter;
     template<typename Sorter>
     struct container_aware_adapter;
     template<typename Sorter, typename CountType=std::size_t>
@@ -76,6 +82,8 @@ namespace cppsort
     template<typename Sorter>
     struct out_of_place_adapter;
     template<typename Sorter>
+    struct prefix_cache_adapter;
+    template<typename Sorter>
     struct schwartz_adapter;
     template<typename Sorter>
     struct self_sort_adapter;
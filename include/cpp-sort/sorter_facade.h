@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2019 Morwenn
+ * Copyright (c) 2015-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_SORTER_FACADE_H_
@@ -15,6 +15,7 @@
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/functional.h>
 #include "detail/config.h"
+#include "detail/contiguous_iterator.h"
 #include "detail/projection_compare.h"
 #include "detail/type_traits.h"
 
@@ -188,9 +189,9 @@ namespace cppsort
 
         template<typename Iterator>
         auto operator()(Iterator first, Iterator last) const
-            -> decltype(Sorter::operator()(std::move(first), std::move(last)))
+            -> decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last)))
         {
-            return Sorter::operator()(std::move(first), std::move(last));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last));
         }
 
         template<typename Iterable>
@@ -207,10 +208,10 @@ namespace cppsort
         auto operator()(Iterable&& iterable) const
             -> std::enable_if_t<
                 not detail::has_sort<Sorter, Iterable>::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable)))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable)))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable));
         }
 
         ////////////////////////////////////////////////////////////
@@ -224,12 +225,12 @@ namespace cppsort
                     Iterator,
                     refined_t<decltype(*first), Compare>
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last),
-                                            refined<decltype(*first)>(std::move(compare))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last),
+                                                          refined<decltype(*first)>(std::move(compare))))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last),
-                                      refined<decltype(*first)>(std::move(compare)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last),
+                                                    refined<decltype(*first)>(std::move(compare)));
         }
 
         template<typename Iterable, typename Compare>
@@ -261,12 +262,12 @@ namespace cppsort
                     decltype(std::begin(iterable)),
                     refined_t<decltype(*std::begin(iterable)), Compare>
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                            refined<decltype(*std::begin(iterable))>(std::move(compare))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                          refined<decltype(*std::begin(iterable))>(std::move(compare))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                      refined<decltype(*std::begin(iterable))>(std::move(compare)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                    refined<decltype(*std::begin(iterable))>(std::move(compare)));
         }
 
         ////////////////////////////////////////////////////////////
@@ -285,12 +286,12 @@ namespace cppsort
                     Iterator,
                     refined_t<decltype(*first), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last),
-                                            refined<decltype(*first)>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last),
+                                                          refined<decltype(*first)>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last),
-                                      refined<decltype(*first)>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last),
+                                                    refined<decltype(*first)>(std::move(projection)));
         }
 
         template<typename Iterator, typename Projection>
@@ -307,12 +308,12 @@ namespace cppsort
                     std::less<>,
                     refined_t<decltype(*first), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last), std::less<>{},
-                                            refined<decltype(*first)>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last), std::less<>{},
+                                                          refined<decltype(*first)>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last), std::less<>{},
-                                      refined<decltype(*first)>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last), std::less<>{},
+                                                    refined<decltype(*first)>(std::move(projection)));
         }
 
         template<typename Iterable, typename Projection>
@@ -392,12 +393,12 @@ namespace cppsort
                     decltype(std::begin(iterable)),
                     refined_t<decltype(*std::begin(iterable)), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                            refined<decltype(*std::begin(iterable))>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                          refined<decltype(*std::begin(iterable))>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                      refined<decltype(*std::begin(iterable))>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                    refined<decltype(*std::begin(iterable))>(std::move(projection)));
         }
 
         template<typename Iterable, typename Projection>
@@ -425,12 +426,12 @@ namespace cppsort
                     std::less<>,
                     refined_t<decltype(*std::begin(iterable)), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable), std::less<>{},
-                                            refined<decltype(*std::begin(iterable))>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable), std::less<>{},
+                                                          refined<decltype(*std::begin(iterable))>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable), std::less<>{},
-                                      refined<decltype(*std::begin(iterable))>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable), std::less<>{},
+                                                    refined<decltype(*std::begin(iterable))>(std::move(projection)));
         }
 
         ////////////////////////////////////////////////////////////
@@ -440,10 +441,10 @@ namespace cppsort
         auto operator()(Iterator first, Iterator last, std::less<>) const
             -> std::enable_if_t<
                 not detail::has_comparison_sort_iterator<Sorter, Iterator, std::less<>>::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last)))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last)))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last));
         }
 
         template<typename Iterable>
@@ -473,10 +474,10 @@ namespace cppsort
                     std::less<>,
                     utility::identity
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last)))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last)))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last));
         }
 
         template<typename Iterable>
@@ -512,14 +513,14 @@ namespace cppsort
                     refined_t<decltype(*first), Compare>,
                     refined_t<decltype(*first), Projection>
                 >::value,
-                decltype(Sorter::operator()(first, last,
-                                            refined<decltype(*first)>(std::move(compare)),
-                                            refined<decltype(*first)>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, first, last,
+                                                          refined<decltype(*first)>(std::move(compare)),
+                                                          refined<decltype(*first)>(std::move(projection))))
             >
         {
-            return Sorter::operator()(first, last,
-                                      refined<decltype(*first)>(std::move(compare)),
-                                      refined<decltype(*first)>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, first, last,
+                                                    refined<decltype(*first)>(std::move(compare)),
+                                                    refined<decltype(*first)>(std::move(projection)));
         }
 
         template<typename Iterable, typename Compare, typename Projection>
@@ -556,14 +557,14 @@ namespace cppsort
                     refined_t<decltype(*std::begin(iterable)), Compare>,
                     refined_t<decltype(*std::begin(iterable)), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                            refined<decltype(*std::begin(iterable))>(compare),
-                                            refined<decltype(*std::begin(iterable))>(projection)))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                          refined<decltype(*std::begin(iterable))>(compare),
+                                                          refined<decltype(*std::begin(iterable))>(projection)))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                      refined<decltype(*std::begin(iterable))>(std::move(compare)),
-                                      refined<decltype(*std::begin(iterable))>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                    refined<decltype(*std::begin(iterable))>(std::move(compare)),
+                                                    refined<decltype(*std::begin(iterable))>(std::move(projection)));
         }
 
         ////////////////////////////////////////////////////////////
@@ -578,10 +579,10 @@ namespace cppsort
                     std::less<>,
                     utility::identity
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last)))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last)))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last));
         }
 
         template<typename Iterable>
@@ -608,12 +609,12 @@ namespace cppsort
                     std::less<>,
                     refined_t<decltype(*first), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last), std::less<>{},
-                                            refined<decltype(*first)>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last), std::less<>{},
+                                                          refined<decltype(*first)>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last), std::less<>{},
-                                      refined<decltype(*first)>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last), std::less<>{},
+                                                    refined<decltype(*first)>(std::move(projection)));
         }
 
         template<typename Iterator, typename Projection>
@@ -630,12 +631,12 @@ namespace cppsort
                     Iterator,
                     refined_t<decltype(*first), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::move(first), std::move(last),
-                                            refined<decltype(*first)>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last),
+                                                          refined<decltype(*first)>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::move(first), std::move(last),
-                                      refined<decltype(*first)>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::move(first), std::move(last),
+                                                    refined<decltype(*first)>(std::move(projection)));
         }
 
         template<typename Iterable, typename Projection>
@@ -670,12 +671,12 @@ namespace cppsort
                     std::less<>,
                     refined_t<decltype(*std::begin(iterable)), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable), std::less<>{},
-                                            refined<decltype(*std::begin(iterable))>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable), std::less<>{},
+                                                          refined<decltype(*std::begin(iterable))>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable), std::less<>{},
-                                      refined<decltype(*std::begin(iterable))>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable), std::less<>{},
+                                                    refined<decltype(*std::begin(iterable))>(std::move(projection)));
         }
 
         template<typename Iterable, typename Projection>
@@ -731,12 +732,12 @@ namespace cppsort
                     decltype(std::begin(iterable)),
                     refined_t<decltype(*std::begin(iterable)), Projection>
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                            refined<decltype(*std::begin(iterable))>(std::move(projection))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                          refined<decltype(*std::begin(iterable))>(std::move(projection))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                      refined<decltype(*std::begin(iterable))>(std::move(projection)));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                    refined<decltype(*std::begin(iterable))>(std::move(projection)));
         }
 
         ////////////////////////////////////////////////////////////
@@ -757,14 +758,14 @@ namespace cppsort
                     Iterator,
                     detail::projection_compare<std::less<>, refined_t<decltype(*first), Projection>>
                 >::value,
-                decltype(Sorter::operator()(first, last,
-                                            detail::make_projection_compare(std::less<>{},
-                                                                            refined<decltype(*first)>(std::move(projection)))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, first, last,
+                                                          detail::make_projection_compare(std::less<>{},
+                                                                                          refined<decltype(*first)>(std::move(projection)))))
             >
         {
-            return Sorter::operator()(first, last,
-                                      detail::make_projection_compare(std::less<>{},
-                                                                      refined<decltype(*first)>(std::move(projection))));
+            return detail::invoke_unwrapped<Sorter>(*this, first, last,
+                                                    detail::make_projection_compare(std::less<>{},
+                                                                                    refined<decltype(*first)>(std::move(projection))));
         }
 
         template<typename Iterator, typename Compare, typename Projection>
@@ -785,12 +786,12 @@ namespace cppsort
                         refined_t<decltype(*first), Projection>
                     >
                 >::value,
-                decltype(Sorter::operator()(first, last, detail::make_projection_compare(
+                decltype(detail::invoke_unwrapped<Sorter>(*this, first, last, detail::make_projection_compare(
                     refined<decltype(*first)>(std::move(compare)),
                     refined<decltype(*first)>(std::move(projection)))))
             >
         {
-            return Sorter::operator()(first, last, detail::make_projection_compare(
+            return detail::invoke_unwrapped<Sorter>(*this, first, last, detail::make_projection_compare(
                 refined<decltype(*first)>(std::move(compare)),
                 refined<decltype(*first)>(std::move(projection))));
         }
@@ -855,14 +856,14 @@ namespace cppsort
                         refined_t<decltype(*std::begin(iterable)), Projection>
                     >
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                            detail::make_projection_compare(std::less<>{},
-                                                                            refined<decltype(*std::begin(iterable))>(std::move(projection)))))
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                          detail::make_projection_compare(std::less<>{},
+                                                                                          refined<decltype(*std::begin(iterable))>(std::move(projection)))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable),
-                                      detail::make_projection_compare(std::less<>{},
-                                                                      refined<decltype(*std::begin(iterable))>(std::move(projection))));
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable),
+                                                    detail::make_projection_compare(std::less<>{},
+                                                                                    refined<decltype(*std::begin(iterable))>(std::move(projection))));
         }
 
         template<typename Iterable, typename Compare, typename Projection>
@@ -917,12 +918,12 @@ namespace cppsort
                         refined_t<decltype(*std::begin(iterable)), Projection>
                     >
                 >::value,
-                decltype(Sorter::operator()(std::begin(iterable), std::end(iterable), detail::make_projection_compare(
+                decltype(detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable), detail::make_projection_compare(
                     refined<decltype(*std::begin(iterable))>(std::move(compare)),
                     refined<decltype(*std::begin(iterable))>(std::move(projection)))))
             >
         {
-            return Sorter::operator()(std::begin(iterable), std::end(iterable), detail::make_projection_compare(
+            return detail::invoke_unwrapped<Sorter>(*this, std::begin(iterable), std::end(iterable), detail::make_projection_compare(
                 refined<decltype(*std::begin(iterable))>(std::move(compare)),
                 refined<decltype(*std::begin(iterable))>(std::move(projection))));
         }
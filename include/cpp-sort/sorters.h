@@ -9,14 +9,17 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <cpp-sort/sorters/block_sorter.h>
+#include <cpp-sort/sorters/burst_sorter.h>
 #include <cpp-sort/sorters/counting_sorter.h>
 #include <cpp-sort/sorters/default_sorter.h>
 #include <cpp-sort/sorters/drop_merge_sorter.h>
 #include <cpp-sort/sorters/grail_sorter.h>
 #include <cpp-sort/sorters/heap_sorter.h>
 #include <cpp-sort/sorters/insertion_sorter.h>
+#include <cpp-sort/sorters/lcp_merge_sorter.h>
 #include <cpp-sort/sorters/merge_insertion_sorter.h>
 #include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/multikey_quick_sorter.h>
 #include <cpp-sort/sorters/pdq_sorter.h>
 #include <cpp-sort/sorters/poplar_sorter.h>
 #include <cpp-sort/sorters/quick_merge_sorter.h>
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_BURST_SORTER_H_
+#define CPPSORT_SORTERS_BURST_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/burstsort.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/string_key.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        struct burst_sorter_impl
+        {
+            ////////////////////////////////////////////////////////////
+            // Ascending string sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "burst_sorter requires at least random-access iterators"
+                );
+
+                burstsort<false>(std::move(first), std::move(last), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Descending string sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            std::greater<>, Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "burst_sorter requires at least random-access iterators"
+                );
+
+                burstsort<true>(std::move(first), std::move(last), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::false_type;
+        };
+    }
+
+    struct burst_sorter:
+        sorter_facade<detail::burst_sorter_impl>
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& burst_sort
+            = utility::static_const<burst_sorter>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_BURST_SORTER_H_
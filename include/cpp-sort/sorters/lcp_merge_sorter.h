@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_LCP_MERGE_SORTER_H_
+#define CPPSORT_SORTERS_LCP_MERGE_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/lcp_merge_sort.h"
+#include "../detail/string_key.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        struct lcp_merge_sorter_impl
+        {
+            ////////////////////////////////////////////////////////////
+            // Ascending string sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "lcp_merge_sorter requires at least random-access iterators"
+                );
+
+                lcp_merge_sort<false>(std::move(first), std::move(last), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Descending string sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            std::greater<>, Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "lcp_merge_sorter requires at least random-access iterators"
+                );
+
+                lcp_merge_sort<true>(std::move(first), std::move(last), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Ascending string sort computing the LCP array
+
+            template<
+                typename RandomAccessIterator,
+                typename OutputIterator,
+                typename Projection = utility::identity
+            >
+            auto sort_with_lcp(RandomAccessIterator first, RandomAccessIterator last,
+                               OutputIterator lcp, Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value,
+                    OutputIterator
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "lcp_merge_sorter requires at least random-access iterators"
+                );
+
+                return lcp_merge_sort<false>(std::move(first), std::move(last),
+                                             std::move(lcp), std::move(projection));
+            }
+
+            template<
+                typename RandomAccessIterable,
+                typename OutputIterator,
+                typename Projection = utility::identity
+            >
+            auto sort_with_lcp(RandomAccessIterable&& iterable,
+                               OutputIterator lcp, Projection projection={}) const
+                -> decltype(this->sort_with_lcp(std::begin(iterable), std::end(iterable),
+                                                std::move(lcp), std::move(projection)))
+            {
+                return sort_with_lcp(std::begin(iterable), std::end(iterable),
+                                     std::move(lcp), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::true_type;
+        };
+    }
+
+    struct lcp_merge_sorter:
+        sorter_facade<detail::lcp_merge_sorter_impl>
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& lcp_merge_sort
+            = utility::static_const<lcp_merge_sorter>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_LCP_MERGE_SORTER_H_
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_MULTIKEY_QUICK_SORTER_H_
+#define CPPSORT_SORTERS_MULTIKEY_QUICK_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/multikey_quicksort.h"
+#include "../detail/string_key.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        struct multikey_quick_sorter_impl
+        {
+            ////////////////////////////////////////////////////////////
+            // Ascending string sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "multikey_quick_sorter requires at least random-access iterators"
+                );
+
+                multikey_quicksort<false>(std::move(first), std::move(last), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Descending string sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            std::greater<>, Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "multikey_quick_sorter requires at least random-access iterators"
+                );
+
+                multikey_quicksort<true>(std::move(first), std::move(last), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Ascending string sort computing the LCP array
+
+            template<
+                typename RandomAccessIterator,
+                typename LcpIterator,
+                typename Projection = utility::identity
+            >
+            auto sort_with_lcp(RandomAccessIterator first, RandomAccessIterator last,
+                               LcpIterator lcp, Projection projection={}) const
+                -> std::enable_if_t<
+                    is_string_key<projected_t<RandomAccessIterator, Projection>>::value,
+                    LcpIterator
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "multikey_quick_sorter requires at least random-access iterators"
+                );
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<LcpIterator>
+                    >::value,
+                    "multikey_quick_sorter requires a random-access iterator to store the LCP array"
+                );
+
+                return multikey_quicksort<false>(std::move(first), std::move(last),
+                                                 std::move(lcp), std::move(projection));
+            }
+
+            template<
+                typename RandomAccessIterable,
+                typename LcpIterator,
+                typename Projection = utility::identity
+            >
+            auto sort_with_lcp(RandomAccessIterable&& iterable,
+                               LcpIterator lcp, Projection projection={}) const
+                -> decltype(this->sort_with_lcp(std::begin(iterable), std::end(iterable),
+                                                std::move(lcp), std::move(projection)))
+            {
+                return sort_with_lcp(std::begin(iterable), std::end(iterable),
+                                     std::move(lcp), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::false_type;
+        };
+    }
+
+    struct multikey_quick_sorter:
+        sorter_facade<detail::multikey_quick_sorter_impl>
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& multikey_quick_sort
+            = utility::static_const<multikey_quick_sorter>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_MULTIKEY_QUICK_SORTER_H_
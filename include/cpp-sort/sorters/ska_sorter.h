@@ -13,11 +13,14 @@
 #include <utility>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/comparators/total_greater.h>
+#include <cpp-sort/comparators/total_less.h>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/static_const.h>
 #include "../detail/iterator_traits.h"
 #include "../detail/ska_sort.h"
+#include "../detail/total_order_key.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -53,6 +56,61 @@ namespace cppsort
                 ska_sort(std::move(first), std::move(last), std::move(projection));
             }
 
+            ////////////////////////////////////////////////////////////
+            // IEEE 754 totalOrder sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity,
+                typename = std::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            total_less_t, Projection projection={}) const
+                -> std::enable_if_t<detail::has_total_order_key<
+                    projected_t<RandomAccessIterator, Projection>
+                >::value>
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "ska_sorter requires at least random-access iterators"
+                );
+
+                // Sort the unsigned keys directly so that the small
+                // partitions fallback also honours totalOrder
+                ska_sort(std::move(first), std::move(last),
+                         std::move(projection) | total_order_key_fn<false>{});
+            }
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity,
+                typename = std::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            total_greater_t, Projection projection={}) const
+                -> std::enable_if_t<detail::has_total_order_key<
+                    projected_t<RandomAccessIterator, Projection>
+                >::value>
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "ska_sorter requires at least random-access iterators"
+                );
+
+                ska_sort(std::move(first), std::move(last),
+                         std::move(projection) | total_order_key_fn<true>{});
+            }
+
             ////////////////////////////////////////////////////////////
             // Sorter traits
 
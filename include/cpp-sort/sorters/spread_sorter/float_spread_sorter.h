@@ -15,9 +15,13 @@
 #include <utility>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/comparators/total_greater.h>
+#include <cpp-sort/comparators/total_less.h>
 #include <cpp-sort/utility/static_const.h>
 #include "../../detail/iterator_traits.h"
 #include "../../detail/spreadsort/float_sort.h"
+#include "../../detail/spreadsort/integer_sort.h"
+#include "../../detail/total_order_key.h"
 
 namespace cppsort
 {
@@ -53,6 +57,57 @@ namespace cppsort
                 spreadsort::float_sort(std::move(first), std::move(last), std::move(projection));
             }
 
+            ////////////////////////////////////////////////////////////
+            // IEEE 754 totalOrder sort
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            total_less_t, Projection projection={}) const
+                -> std::enable_if_t<
+                    has_total_order_key<projected_t<RandomAccessIterator, Projection>>::value &&
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "float_spread_sorter requires at least random-access iterators"
+                );
+
+                // The unsigned keys are ordered according to totalOrder,
+                // which integer_sort handles without any special case
+                spreadsort::integer_sort(std::move(first), std::move(last),
+                                         std::move(projection) | total_order_key_fn<false>{});
+            }
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            total_greater_t, Projection projection={}) const
+                -> std::enable_if_t<
+                    has_total_order_key<projected_t<RandomAccessIterator, Projection>>::value &&
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "float_spread_sorter requires at least random-access iterators"
+                );
+
+                spreadsort::integer_sort(std::move(first), std::move(last),
+                                         std::move(projection) | total_order_key_fn<true>{});
+            }
+
             ////////////////////////////////////////////////////////////
             // Sorter traits
 
@@ -10,6 +10,7 @@
 ////////////////////////////////////////////////////////////
 #include <cstddef>
 #include <cstdint>
+#include <climits>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -19,6 +20,7 @@
 #include <cpp-sort/utility/static_const.h>
 #include "../../detail/iterator_traits.h"
 #include "../../detail/spreadsort/integer_sort.h"
+#include "../../detail/type_traits.h"
 
 namespace cppsort
 {
@@ -27,6 +29,84 @@ namespace cppsort
 
     namespace detail
     {
+        ////////////////////////////////////////////////////////////
+        // Biggest integer handled by integer_spread_sorter
+
+#ifdef __SIZEOF_INT128__
+        using spread_sort_max_key_t = __uint128_t;
+#else
+        using spread_sort_max_key_t = std::uintmax_t;
+#endif
+
+        template<typename T>
+        struct is_integer_spread_sortable:
+            std::integral_constant<bool,
+                detail::is_integral<T>::value &&
+                sizeof(T) <= sizeof(spread_sort_max_key_t)
+            >
+        {};
+
+        ////////////////////////////////////////////////////////////
+        // Pairs of integers are sorted lexicographically by packing
+        // them into an unsigned integer big enough to hold both
+
+        template<std::size_t Size>
+        using integer_pair_key_t = conditional_t<
+            Size <= sizeof(std::uint32_t),
+            std::uint32_t,
+            conditional_t<
+                Size <= sizeof(std::uint64_t),
+                std::uint64_t,
+                spread_sort_max_key_t
+            >
+        >;
+
+        template<typename T>
+        struct is_integer_pair_spread_sortable:
+            std::false_type
+        {};
+
+        template<typename T, typename U>
+        struct is_integer_pair_spread_sortable<std::pair<T, U>>:
+            std::integral_constant<bool,
+                detail::is_integral<T>::value &&
+                detail::is_integral<U>::value &&
+                sizeof(T) + sizeof(U) <= sizeof(spread_sort_max_key_t)
+            >
+        {};
+
+        template<typename Key, typename T>
+        auto to_unsigned_key(T value)
+            -> std::enable_if_t<detail::is_signed<T>::value, Key>
+        {
+            // Flip the sign bit so that negative values come first
+            using unsigned_t = integer_pair_key_t<sizeof(T)>;
+            return static_cast<Key>(
+                (static_cast<unsigned_t>(value) ^ (unsigned_t(1) << (CHAR_BIT * sizeof(T) - 1)))
+                & (unsigned_t(-1) >> (CHAR_BIT * (sizeof(unsigned_t) - sizeof(T))))
+            );
+        }
+
+        template<typename Key, typename T>
+        auto to_unsigned_key(T value)
+            -> std::enable_if_t<not detail::is_signed<T>::value, Key>
+        {
+            return static_cast<Key>(value);
+        }
+
+        struct integer_pair_key:
+            utility::projection_base
+        {
+            template<typename T, typename U>
+            auto operator()(const std::pair<T, U>& value) const
+                -> integer_pair_key_t<sizeof(T) + sizeof(U)>
+            {
+                using key_t = integer_pair_key_t<sizeof(T) + sizeof(U)>;
+                return (to_unsigned_key<key_t>(value.first) << (CHAR_BIT * sizeof(U)))
+                     | to_unsigned_key<key_t>(value.second);
+            }
+        };
+
         struct integer_spread_sorter_impl
         {
             template<
@@ -36,10 +116,7 @@ namespace cppsort
             auto operator()(RandomAccessIterator first, RandomAccessIterator last,
                             Projection projection={}) const
                 -> std::enable_if_t<
-                    std::is_integral<projected_t<RandomAccessIterator, Projection>>::value && (
-                        sizeof(projected_t<RandomAccessIterator, Projection>) <= sizeof(std::size_t) ||
-                        sizeof(projected_t<RandomAccessIterator, Projection>) <= sizeof(std::uintmax_t)
-                    ) &&
+                    is_integer_spread_sortable<projected_t<RandomAccessIterator, Projection>>::value &&
                     is_projection_iterator_v<Projection, RandomAccessIterator>
                 >
             {
@@ -54,6 +131,29 @@ namespace cppsort
                 spreadsort::integer_sort(std::move(first), std::move(last), std::move(projection));
             }
 
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> std::enable_if_t<
+                    is_integer_pair_spread_sortable<projected_t<RandomAccessIterator, Projection>>::value &&
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "integer_spread_sorter requires at least random-access iterators"
+                );
+
+                spreadsort::integer_sort(std::move(first), std::move(last),
+                                         std::move(projection) | integer_pair_key{});
+            }
+
             ////////////////////////////////////////////////////////////
             // Sorter traits
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_APPLY_PERMUTATION_H_
+#define CPPSORT_UTILITY_APPLY_PERMUTATION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <cpp-sort/utility/size.h>
+#include "../detail/apply_permutation.h"
+#include "../detail/config.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // In place
+
+    template<typename Permutation>
+    auto apply_permutation(const Permutation&)
+        -> void
+    {}
+
+    template<typename Permutation, typename RandomAccessIterable, typename... RandomAccessIterables>
+    auto apply_permutation(const Permutation& permutation, RandomAccessIterable&& iterable,
+                           RandomAccessIterables&&... iterables)
+        -> void
+    {
+        auto size = static_cast<std::size_t>(utility::size(permutation));
+        CPPSORT_ASSERT(static_cast<std::size_t>(utility::size(iterable)) == size);
+
+        auto perm = std::begin(permutation);
+        cppsort::detail::apply_permutation(
+            std::begin(iterable), size,
+            [perm](std::size_t pos) { return static_cast<std::size_t>(perm[pos]); }
+        );
+        apply_permutation(permutation, std::forward<RandomAccessIterables>(iterables)...);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Out of place
+
+    template<typename Permutation, typename RandomAccessIterator, typename OutputIterator>
+    auto apply_permutation_copy(const Permutation& permutation,
+                                RandomAccessIterator first, OutputIterator result)
+        -> OutputIterator
+    {
+        auto perm = std::begin(permutation);
+        return cppsort::detail::apply_permutation_copy(
+            first, static_cast<std::size_t>(utility::size(permutation)),
+            [perm](std::size_t pos) { return static_cast<std::size_t>(perm[pos]); },
+            std::move(result)
+        );
+    }
+
+    namespace detail
+    {
+        template<typename Permutation>
+        auto apply_permutation_copy_tuple(const Permutation&)
+            -> std::tuple<>
+        {
+            return {};
+        }
+
+        template<
+            typename Permutation,
+            typename RandomAccessIterator,
+            typename OutputIterator,
+            typename... Iterators
+        >
+        auto apply_permutation_copy_tuple(const Permutation& permutation,
+                                          RandomAccessIterator first, OutputIterator result,
+                                          Iterators... iterators)
+            -> decltype(auto)
+        {
+            auto res = utility::apply_permutation_copy(permutation, std::move(first),
+                                                       std::move(result));
+            return std::tuple_cat(std::make_tuple(std::move(res)),
+                                  apply_permutation_copy_tuple(permutation, std::move(iterators)...));
+        }
+    }
+
+    template<
+        typename Permutation,
+        typename RandomAccessIterator1, typename OutputIterator1,
+        typename RandomAccessIterator2, typename OutputIterator2,
+        typename... Iterators
+    >
+    auto apply_permutation_copy(const Permutation& permutation,
+                                RandomAccessIterator1 first1, OutputIterator1 result1,
+                                RandomAccessIterator2 first2, OutputIterator2 result2,
+                                Iterators... iterators)
+        -> decltype(auto)
+    {
+        static_assert(sizeof...(Iterators) % 2 == 0,
+                      "apply_permutation_copy takes pairs of input and output iterators");
+        return detail::apply_permutation_copy_tuple(
+            permutation,
+            std::move(first1), std::move(result1),
+            std::move(first2), std::move(result2),
+            std::move(iterators)...
+        );
+    }
+}}
+
+#endif // CPPSORT_UTILITY_APPLY_PERMUTATION_H_
@@ -0,0 +1,602 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_EXTERNAL_SORT_H_
+#define CPPSORT_UTILITY_EXTERNAL_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/kway_merge.h"
+#include "../detail/memory.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Tuning knobs of external_sort
+
+    struct external_sort_options
+    {
+        // Memory used to sort a run, and to buffer the inputs
+        // and the output of a merge, in bytes
+        std::size_t memory_limit = std::size_t(1) << 30;
+
+        // Size of the individual reads and writes during the
+        // merges, in bytes
+        std::size_t block_size = std::size_t(1) << 22;
+
+        // Maximum number of runs merged at once, every one of
+        // them needs an open file
+        std::size_t merge_order = 128;
+
+        // Directory where the runs are stored, the standard
+        // library's temporary files are used when empty
+        std::string temporary_directory;
+    };
+
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Error reporting
+
+        [[noreturn]] inline auto throw_io_error(const std::string& what)
+            -> void
+        {
+            int error = errno;
+            throw std::system_error(error, std::generic_category(),
+                                    "cppsort::utility::external_sort: " + what);
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Owning handle to a C file, temporary files given a path
+        // are removed when closed
+
+        class file_handle
+        {
+            public:
+
+                file_handle() = default;
+
+                explicit file_handle(std::FILE* file, std::string path={}):
+                    file(file),
+                    path(std::move(path))
+                {}
+
+                file_handle(file_handle&& other) noexcept:
+                    file(other.file),
+                    path(std::move(other.path))
+                {
+                    other.file = nullptr;
+                    other.path.clear();
+                }
+
+                auto operator=(file_handle&& other) noexcept
+                    -> file_handle&
+                {
+                    if (this != &other) {
+                        close();
+                        file = other.file;
+                        path = std::move(other.path);
+                        other.file = nullptr;
+                        other.path.clear();
+                    }
+                    return *this;
+                }
+
+                ~file_handle()
+                {
+                    close();
+                }
+
+                auto get() const noexcept
+                    -> std::FILE*
+                {
+                    return file;
+                }
+
+                auto close() noexcept
+                    -> bool
+                {
+                    if (file == nullptr) {
+                        return true;
+                    }
+                    bool res = std::fclose(file) == 0;
+                    file = nullptr;
+                    if (not path.empty()) {
+                        std::remove(path.c_str());
+                        path.clear();
+                    }
+                    return res;
+                }
+
+            private:
+
+                std::FILE* file = nullptr;
+                std::string path;
+        };
+
+        inline auto open_file(const std::string& path, const char* mode)
+            -> file_handle
+        {
+            std::FILE* file = std::fopen(path.c_str(), mode);
+            if (file == nullptr) {
+                throw_io_error("can't open " + path);
+            }
+            return file_handle(file);
+        }
+
+        inline auto make_temporary_file(const std::string& directory)
+            -> file_handle
+        {
+            if (directory.empty()) {
+                std::FILE* file = std::tmpfile();
+                if (file == nullptr) {
+                    throw_io_error("can't create a temporary file");
+                }
+                return file_handle(file);
+            }
+
+            std::random_device device;
+            for (int attempt = 0 ; attempt < 100 ; ++attempt) {
+                auto path = directory + "/cppsort-run-"
+                          + std::to_string(device()) + std::to_string(device())
+                          + ".tmp";
+                // "x" makes the opening fail if the file already exists
+                if (std::FILE* file = std::fopen(path.c_str(), "w+bx")) {
+                    return file_handle(file, std::move(path));
+                }
+            }
+            throw_io_error("can't create a temporary file in " + directory);
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Uninitialized storage for records, which are trivially
+        // copyable and thus only ever read and written as bytes
+
+        template<typename Record>
+        using record_buffer = std::unique_ptr<Record, cppsort::detail::operator_deleter>;
+
+        template<typename Record>
+        auto make_record_buffer(std::size_t size)
+            -> record_buffer<Record>
+        {
+            return record_buffer<Record>(
+                static_cast<Record*>(::operator new(size * sizeof(Record))),
+                cppsort::detail::operator_deleter(size * sizeof(Record))
+            );
+        }
+
+        template<typename Record>
+        auto read_records(std::FILE* file, Record* buffer, std::size_t size)
+            -> std::size_t
+        {
+            auto bytes = std::fread(buffer, 1, size * sizeof(Record), file);
+            if (bytes != size * sizeof(Record) && std::ferror(file)) {
+                throw_io_error("read error");
+            }
+            if (bytes % sizeof(Record) != 0) {
+                throw std::runtime_error(
+                    "cppsort::utility::external_sort: the size of the input "
+                    "is not a multiple of the size of a record"
+                );
+            }
+            return bytes / sizeof(Record);
+        }
+
+        template<typename Record>
+        auto write_records(std::FILE* file, const Record* buffer, std::size_t size)
+            -> void
+        {
+            if (std::fwrite(buffer, sizeof(Record), size, file) != size) {
+                throw_io_error("write error");
+            }
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Sequential reader of a sorted run: the next block is read
+        // in the background while the current one is consumed
+
+        template<typename Record>
+        class run_reader
+        {
+            public:
+
+                run_reader(std::FILE* file, std::size_t block_records):
+                    file(file),
+                    block_records(block_records),
+                    current(make_record_buffer<Record>(block_records)),
+                    next(make_record_buffer<Record>(block_records))
+                {
+                    std::rewind(file);
+                    size = read_records(file, current.get(), block_records);
+                    if (size == block_records) {
+                        read_ahead();
+                    }
+                }
+
+                auto empty() const noexcept
+                    -> bool
+                {
+                    return pos == size;
+                }
+
+                auto front() const noexcept
+                    -> const Record&
+                {
+                    return current.get()[pos];
+                }
+
+                auto pop()
+                    -> void
+                {
+                    if (++pos != size) {
+                        return;
+                    }
+                    if (not pending.valid()) {
+                        // The end of the run was already reached
+                        return;
+                    }
+                    size = pending.get();
+                    pos = 0;
+                    std::swap(current, next);
+                    if (size == block_records) {
+                        read_ahead();
+                    }
+                }
+
+            private:
+
+                auto read_ahead()
+                    -> void
+                {
+                    std::FILE* f = file;
+                    Record* buffer = next.get();
+                    std::size_t count = block_records;
+                    pending = std::async(std::launch::async, [f, buffer, count] {
+                        return read_records(f, buffer, count);
+                    });
+                }
+
+                std::FILE* file;
+                std::size_t block_records;
+                record_buffer<Record> current;
+                record_buffer<Record> next;
+                std::size_t pos = 0;
+                std::size_t size = 0;
+                std::future<std::size_t> pending;
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Sequential writer: a full block is written in the background
+        // while the next one is being filled
+
+        template<typename Record>
+        class run_writer
+        {
+            public:
+
+                run_writer(std::FILE* file, std::size_t block_records):
+                    file(file),
+                    block_records(block_records),
+                    current(make_record_buffer<Record>(block_records)),
+                    next(make_record_buffer<Record>(block_records))
+                {}
+
+                auto push(const Record& record)
+                    -> void
+                {
+                    std::memcpy(current.get() + size, std::addressof(record), sizeof(Record));
+                    if (++size == block_records) {
+                        write_behind();
+                    }
+                }
+
+                auto flush()
+                    -> void
+                {
+                    write_behind();
+                    wait();
+                    if (std::fflush(file) != 0) {
+                        throw_io_error("write error");
+                    }
+                }
+
+            private:
+
+                auto wait()
+                    -> void
+                {
+                    if (pending.valid()) {
+                        pending.get();
+                    }
+                }
+
+                auto write_behind()
+                    -> void
+                {
+                    wait();
+                    std::swap(current, next);
+                    std::FILE* f = file;
+                    const Record* buffer = next.get();
+                    std::size_t count = size;
+                    pending = std::async(std::launch::async, [f, buffer, count] {
+                        write_records(f, buffer, count);
+                    });
+                    size = 0;
+                }
+
+                std::FILE* file;
+                std::size_t block_records;
+                record_buffer<Record> current;
+                record_buffer<Record> next;
+                std::size_t size = 0;
+                std::future<void> pending;
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Iterators over the readers and the writer, which allow to
+        // merge the runs with the library's k-way merge
+
+        template<typename Record>
+        class run_reader_iterator
+        {
+            public:
+
+                using iterator_category = std::input_iterator_tag;
+                using value_type        = Record;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const Record*;
+                using reference         = const Record&;
+
+                run_reader_iterator() = default;
+
+                explicit run_reader_iterator(run_reader<Record>& reader) noexcept:
+                    reader(&reader)
+                {}
+
+                auto operator*() const noexcept
+                    -> reference
+                {
+                    return reader->front();
+                }
+
+                auto operator++()
+                    -> run_reader_iterator&
+                {
+                    reader->pop();
+                    return *this;
+                }
+
+                // The merge only needs to know whether a run is exhausted
+                friend auto operator==(const run_reader_iterator& lhs, const run_reader_iterator& rhs) noexcept
+                    -> bool
+                {
+                    return lhs.exhausted() == rhs.exhausted();
+                }
+
+                friend auto operator!=(const run_reader_iterator& lhs, const run_reader_iterator& rhs) noexcept
+                    -> bool
+                {
+                    return lhs.exhausted() != rhs.exhausted();
+                }
+
+            private:
+
+                auto exhausted() const noexcept
+                    -> bool
+                {
+                    return reader == nullptr || reader->empty();
+                }
+
+                run_reader<Record>* reader = nullptr;
+        };
+
+        template<typename Record>
+        class run_writer_iterator
+        {
+            public:
+
+                using iterator_category = std::output_iterator_tag;
+                using value_type        = void;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = void;
+                using reference         = void;
+
+                explicit run_writer_iterator(run_writer<Record>& writer) noexcept:
+                    writer(&writer)
+                {}
+
+                auto operator*() noexcept
+                    -> run_writer_iterator&
+                {
+                    return *this;
+                }
+
+                auto operator=(const Record& record)
+                    -> run_writer_iterator&
+                {
+                    writer->push(record);
+                    return *this;
+                }
+
+                auto operator++() noexcept
+                    -> run_writer_iterator&
+                {
+                    return *this;
+                }
+
+            private:
+
+                run_writer<Record>* writer;
+        };
+
+        ////////////////////////////////////////////////////////////
+        // k-way merge of runs with a tournament tree, stable since
+        // ties are won by the run that comes first
+
+        template<typename Record, typename Compare, typename Projection>
+        auto merge_runs(file_handle* first, file_handle* last, std::FILE* output,
+                        const external_sort_options& options,
+                        Compare compare, Projection projection)
+            -> void
+        {
+            // Two blocks per run plus two for the output
+            std::size_t nb_runs = last - first;
+            std::size_t block_bytes = (std::min)(options.block_size,
+                                                 options.memory_limit / (2 * (nb_runs + 1)));
+            std::size_t block_records = (std::max)(block_bytes / sizeof(Record), std::size_t(1));
+
+            std::vector<run_reader<Record>> readers;
+            readers.reserve(nb_runs);
+            for (auto it = first ; it != last ; ++it) {
+                readers.emplace_back(it->get(), block_records);
+            }
+            run_writer<Record> writer(output, block_records);
+
+            using iterator = run_reader_iterator<Record>;
+            std::vector<std::pair<iterator, iterator>> runs;
+            runs.reserve(nb_runs);
+            for (auto& reader: readers) {
+                runs.emplace_back(iterator(reader), iterator());
+            }
+            cppsort::detail::kway_merge<false>(runs.data(), runs.size(),
+                                               run_writer_iterator<Record>(writer),
+                                               std::move(compare), std::move(projection));
+            writer.flush();
+        }
+
+        template<typename Record, typename Sorter, typename Compare, typename Projection>
+        auto external_sort(const Sorter& sorter,
+                           const std::string& input_path, const std::string& output_path,
+                           const external_sort_options& options,
+                           Compare compare, Projection projection)
+            -> std::size_t
+        {
+            static_assert(std::is_trivially_copyable<Record>::value,
+                          "external_sort can only sort trivially copyable records");
+
+            // Generate sorted runs as big as the memory allows
+            std::size_t run_records = (std::max)(options.memory_limit / sizeof(Record),
+                                                 std::size_t(1));
+            auto buffer = make_record_buffer<Record>(run_records);
+
+            file_handle input = open_file(input_path, "rb");
+            std::vector<file_handle> runs;
+            std::size_t count = 0;
+            for (;;) {
+                std::size_t size = read_records(input.get(), buffer.get(), run_records);
+                if (size == 0) {
+                    break;
+                }
+                count += size;
+                sorter(buffer.get(), buffer.get() + size, compare, projection);
+
+                if (runs.empty() && size < run_records) {
+                    // The whole input fits in memory
+                    input.close();
+                    file_handle output = open_file(output_path, "wb");
+                    write_records(output.get(), buffer.get(), size);
+                    if (not output.close()) {
+                        throw_io_error("write error");
+                    }
+                    return count;
+                }
+
+                runs.push_back(make_temporary_file(options.temporary_directory));
+                write_records(runs.back().get(), buffer.get(), size);
+                if (std::fflush(runs.back().get()) != 0) {
+                    throw_io_error("write error");
+                }
+            }
+            input.close();
+            buffer.reset();
+
+            // Merge the runs by groups until few enough remain
+            std::size_t merge_order = (std::max)(options.merge_order, std::size_t(2));
+            while (runs.size() > merge_order) {
+                std::vector<file_handle> merged;
+                for (std::size_t idx = 0 ; idx < runs.size() ; idx += merge_order) {
+                    std::size_t end = (std::min)(idx + merge_order, runs.size());
+                    merged.push_back(make_temporary_file(options.temporary_directory));
+                    merge_runs<Record>(runs.data() + idx, runs.data() + end,
+                                       merged.back().get(), options, compare, projection);
+                    // Reclaim disk space as soon as possible
+                    for (std::size_t i = idx ; i < end ; ++i) {
+                        runs[i].close();
+                    }
+                }
+                runs = std::move(merged);
+            }
+
+            file_handle output = open_file(output_path, "wb");
+            merge_runs<Record>(runs.data(), runs.data() + runs.size(),
+                               output.get(), options, std::move(compare), std::move(projection));
+            if (not output.close()) {
+                throw_io_error("write error");
+            }
+            return count;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // external_sort
+
+    template<
+        typename Record,
+        typename Sorter,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<is_projection_iterator_v<Projection, Record*, Compare>>
+    >
+    auto external_sort(const Sorter& sorter,
+                       const std::string& input_path, const std::string& output_path,
+                       const external_sort_options& options,
+                       Compare compare={}, Projection projection={})
+        -> std::size_t
+    {
+        return detail::external_sort<Record>(sorter, input_path, output_path, options,
+                                             std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename Record,
+        typename Sorter,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, Record*> &&
+            not is_projection_iterator_v<utility::identity, Record*, Projection>
+        >
+    >
+    auto external_sort(const Sorter& sorter,
+                       const std::string& input_path, const std::string& output_path,
+                       const external_sort_options& options,
+                       Projection projection)
+        -> std::size_t
+    {
+        return detail::external_sort<Record>(sorter, input_path, output_path, options,
+                                             std::less<>{}, std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_EXTERNAL_SORT_H_
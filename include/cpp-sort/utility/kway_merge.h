@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_KWAY_MERGE_H_
+#define CPPSORT_UTILITY_KWAY_MERGE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/kway_merge.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        template<typename Iterables>
+        using inner_iterator_t = cppsort::detail::remove_cvref_t<
+            decltype(std::begin(*std::begin(std::declval<Iterables&>())))
+        >;
+
+        template<typename Iterables, typename OutputIterator,
+                 typename Compare, typename Projection>
+        auto kway_merge(Iterables& iterables, OutputIterator out,
+                        Compare compare, Projection projection)
+            -> OutputIterator
+        {
+            using iterator = inner_iterator_t<Iterables>;
+            std::vector<std::pair<iterator, iterator>> runs;
+            for (auto&& iterable: iterables) {
+                runs.emplace_back(std::begin(iterable), std::end(iterable));
+            }
+            return cppsort::detail::kway_merge<false>(runs.data(), runs.size(), std::move(out),
+                                                      std::move(compare), std::move(projection));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // kway_merge: merge a collection of sorted collections into
+    // an output iterator with a single pass
+
+    template<
+        typename Iterables,
+        typename OutputIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, detail::inner_iterator_t<Iterables>, Compare>
+        >
+    >
+    auto kway_merge(Iterables&& iterables, OutputIterator out,
+                    Compare compare={}, Projection projection={})
+        -> OutputIterator
+    {
+        return detail::kway_merge(iterables, std::move(out),
+                                  std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename Iterables,
+        typename OutputIterator,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, detail::inner_iterator_t<Iterables>> &&
+            not is_projection_iterator_v<utility::identity, detail::inner_iterator_t<Iterables>, Projection>
+        >
+    >
+    auto kway_merge(Iterables&& iterables, OutputIterator out, Projection projection)
+        -> OutputIterator
+    {
+        return detail::kway_merge(iterables, std::move(out),
+                                  std::less<>{}, std::move(projection));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // kway_inplace_merge: merge consecutive sorted runs starting
+    // at first, run_ends holds the end of every run
+
+    template<
+        typename RandomAccessIterator,
+        typename RunEnds,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+        >
+    >
+    auto kway_inplace_merge(RandomAccessIterator first, const RunEnds& run_ends,
+                            Compare compare={}, Projection projection={})
+        -> void
+    {
+        cppsort::detail::kway_inplace_merge(std::move(first),
+                                            std::begin(run_ends), std::end(run_ends),
+                                            std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterator,
+        typename RunEnds,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator> &&
+            not is_projection_iterator_v<utility::identity, RandomAccessIterator, Projection>
+        >
+    >
+    auto kway_inplace_merge(RandomAccessIterator first, const RunEnds& run_ends,
+                            Projection projection)
+        -> void
+    {
+        cppsort::detail::kway_inplace_merge(std::move(first),
+                                            std::begin(run_ends), std::end(run_ends),
+                                            std::less<>{}, std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_KWAY_MERGE_H_
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_LAZY_SORTED_VIEW_H_
+#define CPPSORT_UTILITY_LAZY_SORTED_VIEW_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "../detail/bitops.h"
+#include "../detail/insertion_sort.h"
+#include "../detail/iter_sort3.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/pdqsort.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // View over a random-access collection which sorts it in
+    // place lazily, as its elements are read in order
+    //
+    // It relies on incremental quicksort: the pivots found by the
+    // partitions are kept in a stack, and reading the next element
+    // only partitions the part of the collection between it and
+    // the closest pivot, which is always the leftmost unsorted
+    // partition. Reading the first k elements costs O(n + k log k)
+    // on average, and reading all of them costs about as much as
+    // a full pdqsort, whose partitioning functions and pivot
+    // selection are reused here
+
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity
+    >
+    class lazy_sorted_view
+    {
+        public:
+
+            using size_type = std::size_t;
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+            using value_type = cppsort::detail::value_type_t<RandomAccessIterator>;
+            using reference = typename std::iterator_traits<RandomAccessIterator>::reference;
+
+            class iterator
+            {
+                public:
+
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = lazy_sorted_view::value_type;
+                    using difference_type = lazy_sorted_view::difference_type;
+                    using pointer = typename std::iterator_traits<RandomAccessIterator>::pointer;
+                    using reference = lazy_sorted_view::reference;
+
+                    iterator() = default;
+
+                    iterator(lazy_sorted_view* view, size_type pos) noexcept:
+                        view(view),
+                        pos(pos)
+                    {}
+
+                    auto operator*() const
+                        -> reference
+                    {
+                        return (*view)[pos];
+                    }
+
+                    auto operator->() const
+                        -> pointer
+                    {
+                        return std::addressof(**this);
+                    }
+
+                    auto operator++() noexcept
+                        -> iterator&
+                    {
+                        ++pos;
+                        return *this;
+                    }
+
+                    auto operator++(int) noexcept
+                        -> iterator
+                    {
+                        auto tmp = *this;
+                        ++pos;
+                        return tmp;
+                    }
+
+                    friend auto operator==(const iterator& lhs, const iterator& rhs) noexcept
+                        -> bool
+                    {
+                        return lhs.pos == rhs.pos;
+                    }
+
+                    friend auto operator!=(const iterator& lhs, const iterator& rhs) noexcept
+                        -> bool
+                    {
+                        return lhs.pos != rhs.pos;
+                    }
+
+                private:
+
+                    lazy_sorted_view* view = nullptr;
+                    size_type pos = 0;
+            };
+
+            lazy_sorted_view(RandomAccessIterator first, RandomAccessIterator last,
+                             Compare compare={}, Projection projection={}):
+                first(first),
+                size_(static_cast<size_type>(last - first)),
+                compare(std::move(compare)),
+                projection(std::move(projection))
+            {
+                // The end of the collection is the first pivot
+                int bad_allowed = size_ > 1 ? cppsort::detail::log2(last - first) : 0;
+                pivots.push_back({ size_, bad_allowed });
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorted access to the elements
+
+            auto operator[](size_type pos)
+                -> reference
+            {
+                sort_prefix(pos + 1);
+                return first[difference_type(pos)];
+            }
+
+            auto begin() noexcept
+                -> iterator
+            {
+                return { this, 0 };
+            }
+
+            auto end() noexcept
+                -> iterator
+            {
+                return { this, size_ };
+            }
+
+            auto size() const noexcept
+                -> size_type
+            {
+                return size_;
+            }
+
+            // Number of elements at the front of the collection known
+            // to be at their final place
+            auto sorted_size() const noexcept
+                -> size_type
+            {
+                return sorted_until;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Put the count smallest elements at their final place
+
+            auto sort_prefix(size_type count)
+                -> void
+            {
+                using projected_type = cppsort::detail::projected_t<RandomAccessIterator, Projection>;
+                constexpr bool is_branchless =
+                    utility::is_probably_branchless_comparison_v<Compare, projected_type> &&
+                    utility::is_probably_branchless_projection_v<Projection, value_type>;
+
+                if (count > size_) {
+                    count = size_;
+                }
+                while (sorted_until < count) {
+                    sort_next(std::integral_constant<bool, is_branchless>{});
+                }
+            }
+
+        private:
+
+            // Make progress towards the next element in sorted order:
+            // either the leftmost unsorted partition is partitioned
+            // again, or it is small enough to be sorted right away
+            template<bool Branchless>
+            auto sort_next(std::integral_constant<bool, Branchless>)
+                -> void
+            {
+                using namespace cppsort::detail::pdqsort_detail;
+                using utility::iter_swap;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                size_type pivot = pivots.back().pos;
+                int& bad_allowed = pivots.back().bad_allowed;
+                if (pivot == sorted_until) {
+                    // The pivot is already at its place
+                    pivots.pop_back();
+                    ++sorted_until;
+                    return;
+                }
+
+                auto begin = first + difference_type(sorted_until);
+                auto end = first + difference_type(pivot);
+                difference_type size = end - begin;
+                bool leftmost = sorted_until == 0;
+
+                if (size < insertion_sort_threshold) {
+                    if (leftmost) {
+                        cppsort::detail::insertion_sort(begin, end, compare, projection);
+                    } else {
+                        unguarded_insertion_sort(begin, end, compare, projection);
+                    }
+                    sorted_until = pivot;
+                    return;
+                }
+
+                // Choose pivot as median of 3 or pseudomedian of 9
+                difference_type s2 = size / 2;
+                if (size > ninther_threshold) {
+                    cppsort::detail::iter_sort3(begin, begin + s2, end - 1, compare, projection);
+                    cppsort::detail::iter_sort3(begin + 1, begin + (s2 - 1), end - 2, compare, projection);
+                    cppsort::detail::iter_sort3(begin + 2, begin + (s2 + 1), end - 3, compare, projection);
+                    cppsort::detail::iter_sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1),
+                                                compare, projection);
+                    iter_swap(begin, begin + s2);
+                } else {
+                    cppsort::detail::iter_sort3(begin + s2, begin, end - 1, compare, projection);
+                }
+
+                // Elements equivalent to the last sorted element, which
+                // is not greater than any of them, are already sorted
+                if (not leftmost && not comp(proj(*(begin - 1)), proj(*begin))) {
+                    auto pivot_pos = partition_left(begin, end, compare, projection);
+                    sorted_until = static_cast<size_type>(pivot_pos - first) + 1;
+                    return;
+                }
+
+                auto part_result = Branchless ?
+                    partition_right_branchless(begin, end, compare, projection) :
+                    partition_right(begin, end, compare, projection);
+                auto pivot_pos = part_result.first;
+
+                difference_type l_size = pivot_pos - begin;
+                difference_type r_size = end - (pivot_pos + 1);
+                if (l_size < size / 8 || r_size < size / 8) {
+                    // Too many bad partitions: sort the whole partition
+                    // to guarantee O(n log n)
+                    if (--bad_allowed == 0) {
+                        cppsort::detail::heapsort(begin, end, compare, projection);
+                        sorted_until = pivot;
+                        return;
+                    }
+
+                    // Shuffle some elements to break patterns, the same
+                    // way pdqsort does
+                    if (l_size >= insertion_sort_threshold) {
+                        iter_swap(begin, begin + l_size / 4);
+                        iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                        if (l_size > ninther_threshold) {
+                            iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                            iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                            iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                            iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                        }
+                    }
+                    if (r_size >= insertion_sort_threshold) {
+                        iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                        iter_swap(end - 1, end - r_size / 4);
+                        if (r_size > ninther_threshold) {
+                            iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                            iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                            iter_swap(end - 2, end - (1 + r_size / 4));
+                            iter_swap(end - 3, end - (2 + r_size / 4));
+                        }
+                    }
+                } else if (part_result.second &&
+                           partial_insertion_sort(begin, pivot_pos, compare, projection)) {
+                    // The collection was already partitioned and the left
+                    // partition was almost sorted, so might be the right one
+                    sorted_until = static_cast<size_type>(pivot_pos - first) + 1;
+                    if (partial_insertion_sort(pivot_pos + 1, end, compare, projection)) {
+                        sorted_until = pivot;
+                    }
+                    return;
+                }
+
+                // The two new partitions inherit the number of bad
+                // partitions allowed, like in pdqsort
+                pivots.push_back({ static_cast<size_type>(pivot_pos - first), bad_allowed });
+            }
+
+            // Position of a pivot, and number of bad partitions still
+            // allowed in the unsorted partition which ends there
+            struct pivot_info
+            {
+                size_type pos;
+                int bad_allowed;
+            };
+
+            RandomAccessIterator first;
+            size_type size_;
+            Compare compare;
+            Projection projection;
+
+            // Stack of the positions of the pivots found so far that
+            // are past the sorted prefix, the closest one on top: the
+            // elements between two pivots are not sorted, but they are
+            // not smaller than the elements before the first pivot
+            std::vector<pivot_info> pivots;
+            size_type sorted_until = 0;
+    };
+}}
+
+#endif // CPPSORT_UTILITY_LAZY_SORTED_VIEW_H_
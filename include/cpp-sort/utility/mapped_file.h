@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_MAPPED_FILE_H_
+#define CPPSORT_UTILITY_MAPPED_FILE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#else
+#   error "cpp-sort/utility/mapped_file.h requires a POSIX system"
+#endif
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Read-write shared mapping of a whole file in memory: the
+    // contents of the file can be sorted in place with a sorter,
+    // without first reading it in a separate buffer, and changes
+    // are written back to the file by the operating system
+
+    enum class access_advice
+    {
+        normal,
+        sequential,
+        random,
+        will_need
+    };
+
+    class mapped_file
+    {
+        public:
+
+            explicit mapped_file(const std::string& path)
+            {
+                int fd = ::open(path.c_str(), O_RDWR);
+                if (fd == -1) {
+                    throw_error("can't open " + path);
+                }
+
+                struct ::stat info;
+                if (::fstat(fd, &info) == -1) {
+                    int error = errno;
+                    ::close(fd);
+                    errno = error;
+                    throw_error("can't query the size of " + path);
+                }
+                _size = static_cast<std::size_t>(info.st_size);
+
+                // Empty files can't be mapped
+                if (_size != 0) {
+                    void* data = ::mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    if (data == MAP_FAILED) {
+                        int error = errno;
+                        ::close(fd);
+                        errno = error;
+                        throw_error("can't map " + path);
+                    }
+                    _data = static_cast<unsigned char*>(data);
+                }
+                // The mapping stays valid after the file is closed
+                ::close(fd);
+            }
+
+            mapped_file(mapped_file&& other) noexcept:
+                _data(std::exchange(other._data, nullptr)),
+                _size(std::exchange(other._size, 0))
+            {}
+
+            auto operator=(mapped_file&& other) noexcept
+                -> mapped_file&
+            {
+                if (this != &other) {
+                    unmap();
+                    _data = std::exchange(other._data, nullptr);
+                    _size = std::exchange(other._size, 0);
+                }
+                return *this;
+            }
+
+            ~mapped_file()
+            {
+                unmap();
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Mapped memory
+
+            auto data() const noexcept
+                -> unsigned char*
+            {
+                return _data;
+            }
+
+            auto size() const noexcept
+                -> std::size_t
+            {
+                return _size;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Hint the operating system about the future accesses to
+            // the whole mapping or to a part of it, the hints are only
+            // advisory and failures are ignored
+
+            auto advise(access_advice advice) const noexcept
+                -> void
+            {
+                advise(advice, 0, _size);
+            }
+
+            auto advise(access_advice advice, std::size_t offset, std::size_t length) const noexcept
+                -> void
+            {
+                if (_data == nullptr) {
+                    return;
+                }
+                // The address passed to madvise must be page-aligned
+                std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                std::size_t aligned_offset = offset - offset % page_size;
+                (void) ::madvise(_data + aligned_offset, length + (offset - aligned_offset),
+                                 to_native(advice));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Write the changes back to the file and wait for the end
+            // of the operation
+
+            auto sync() const
+                -> void
+            {
+                if (_data != nullptr && ::msync(_data, _size, MS_SYNC) == -1) {
+                    throw_error("can't synchronize the mapped file");
+                }
+            }
+
+        private:
+
+            [[noreturn]] static auto throw_error(const std::string& what)
+                -> void
+            {
+                int error = errno;
+                throw std::system_error(error, std::generic_category(),
+                                        "cppsort::utility::mapped_file: " + what);
+            }
+
+            static auto to_native(access_advice advice) noexcept
+                -> int
+            {
+                switch (advice) {
+                    case access_advice::sequential: return MADV_SEQUENTIAL;
+                    case access_advice::random:     return MADV_RANDOM;
+                    case access_advice::will_need:  return MADV_WILLNEED;
+                    default:                        return MADV_NORMAL;
+                }
+            }
+
+            auto unmap() noexcept
+                -> void
+            {
+                if (_data != nullptr) {
+                    ::munmap(_data, _size);
+                    _data = nullptr;
+                    _size = 0;
+                }
+            }
+
+            unsigned char* _data = nullptr;
+            std::size_t _size = 0;
+    };
+}}
+
+#endif // CPPSORT_UTILITY_MAPPED_FILE_H_
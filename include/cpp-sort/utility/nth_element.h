@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_NTH_ELEMENT_H_
+#define CPPSORT_UTILITY_NTH_ELEMENT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/bitops.h"
+#include "../detail/introselect.h"
+#include "../detail/iterator_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto nth_element(ForwardIterator first, ForwardIterator last,
+                         cppsort::detail::difference_type_t<ForwardIterator> nth,
+                         cppsort::detail::difference_type_t<ForwardIterator> size,
+                         Compare compare, Projection projection)
+            -> ForwardIterator
+        {
+            if (nth >= size) {
+                return last;
+            }
+            // Introselect for every iterator category: the quickselect
+            // of detail/nth_element.h has no bound on bad pivots and is
+            // quadratic on adversarial inputs
+            return cppsort::detail::introselect(std::move(first), std::move(last), nth, size,
+                                                cppsort::detail::log2(size),
+                                                std::move(compare), std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // nth_element: put at position nth the element that would
+        // be there if the collection was sorted, smaller elements
+        // before it and greater elements after it, and return an
+        // iterator to it
+
+        struct nth_element_fn
+        {
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = std::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            cppsort::detail::difference_type_t<ForwardIterator> nth,
+                            Compare compare={}, Projection projection={}) const
+                -> ForwardIterator
+            {
+                auto size = std::distance(first, last);
+                return detail::nth_element(std::move(first), std::move(last), nth, size,
+                                           std::move(compare), std::move(projection));
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Projection,
+                typename = std::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator> &&
+                    not is_projection_iterator_v<utility::identity, ForwardIterator, Projection>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            cppsort::detail::difference_type_t<ForwardIterator> nth,
+                            Projection projection) const
+                -> ForwardIterator
+            {
+                return operator()(std::move(first), std::move(last), nth,
+                                  std::less<>{}, std::move(projection));
+            }
+
+            template<
+                typename ForwardIterable,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = std::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable,
+                            cppsort::detail::difference_type_t<decltype(std::begin(iterable))> nth,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(std::begin(iterable))
+            {
+                return detail::nth_element(std::begin(iterable), std::end(iterable),
+                                           nth, utility::size(iterable),
+                                           std::move(compare), std::move(projection));
+            }
+
+            template<
+                typename ForwardIterable,
+                typename Projection,
+                typename = std::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable> &&
+                    not is_projection_v<utility::identity, ForwardIterable, Projection>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable,
+                            cppsort::detail::difference_type_t<decltype(std::begin(iterable))> nth,
+                            Projection projection) const
+                -> decltype(std::begin(iterable))
+            {
+                return operator()(iterable, nth, std::less<>{}, std::move(projection));
+            }
+        };
+    }
+
+    namespace
+    {
+        constexpr auto&& nth_element = static_const<
+            detail::nth_element_fn
+        >::value;
+    }
+}}
+
+#endif // CPPSORT_UTILITY_NTH_ELEMENT_H_
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_PARTIAL_SORT_H_
+#define CPPSORT_UTILITY_PARTIAL_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/partial_sort.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // partial_sort: sort the k smallest elements of a collection
+    // at its front and return an iterator past them, the order
+    // of the remaining elements is unspecified
+
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+        >
+    >
+    auto partial_sort(RandomAccessIterator first, RandomAccessIterator last,
+                      cppsort::detail::difference_type_t<RandomAccessIterator> k,
+                      Compare compare={}, Projection projection={})
+        -> RandomAccessIterator
+    {
+        static_assert(
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                cppsort::detail::iterator_category_t<RandomAccessIterator>
+            >::value,
+            "partial_sort requires at least random-access iterators"
+        );
+
+        return cppsort::detail::partial_sort(std::move(first), std::move(last), k,
+                                             std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterator,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator> &&
+            not is_projection_iterator_v<utility::identity, RandomAccessIterator, Projection>
+        >
+    >
+    auto partial_sort(RandomAccessIterator first, RandomAccessIterator last,
+                      cppsort::detail::difference_type_t<RandomAccessIterator> k,
+                      Projection projection)
+        -> RandomAccessIterator
+    {
+        return utility::partial_sort(std::move(first), std::move(last), k,
+                                     std::less<>{}, std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto partial_sort(RandomAccessIterable&& iterable,
+                      cppsort::detail::difference_type_t<decltype(std::begin(iterable))> k,
+                      Compare compare={}, Projection projection={})
+        -> decltype(std::begin(iterable))
+    {
+        return utility::partial_sort(std::begin(iterable), std::end(iterable), k,
+                                     std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable> &&
+            not is_projection_v<utility::identity, RandomAccessIterable, Projection>
+        >
+    >
+    auto partial_sort(RandomAccessIterable&& iterable,
+                      cppsort::detail::difference_type_t<decltype(std::begin(iterable))> k,
+                      Projection projection)
+        -> decltype(std::begin(iterable))
+    {
+        return utility::partial_sort(std::begin(iterable), std::end(iterable), k,
+                                     std::less<>{}, std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_PARTIAL_SORT_H_
@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_RECORD_ITERATOR_H_
+#define CPPSORT_UTILITY_RECORD_ITERATOR_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/config.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    //
+    // record_iterator walks a region of memory made of records
+    // whose size is only known at runtime, for example the
+    // contents of a binary file mapped in memory: dereferencing
+    // it returns a record_reference, a proxy to the bytes of a
+    // record, and assigning a record through such a proxy copies
+    // its bytes
+    //
+    // iter_move returns a record_value holding a copy of the
+    // bytes of the record, which is also the value_type of the
+    // iterator: sorters can store it in temporaries or buffers
+    // and assign it back through a record_reference
+    //
+
+    class record_value;
+
+    class record_reference
+    {
+        public:
+
+            record_reference(unsigned char* data, std::size_t size) noexcept:
+                _data(data),
+                _size(size)
+            {}
+
+            record_reference(const record_reference&) = default;
+
+            auto operator=(const record_reference& other) noexcept
+                -> record_reference&
+            {
+                CPPSORT_ASSERT(_size == other._size);
+                std::memmove(_data, other._data, _size);
+                return *this;
+            }
+
+            auto operator=(const record_value& other) noexcept
+                -> record_reference&;
+
+            auto data() const noexcept
+                -> unsigned char*
+            {
+                return _data;
+            }
+
+            auto size() const noexcept
+                -> std::size_t
+            {
+                return _size;
+            }
+
+            friend auto swap(record_reference lhs, record_reference rhs) noexcept
+                -> void
+            {
+                CPPSORT_ASSERT(lhs._size == rhs._size);
+                // Swap through a small buffer, records can be big
+                constexpr std::size_t chunk_size = 64;
+                unsigned char tmp[chunk_size];
+                for (std::size_t pos = 0 ; pos < lhs._size ; pos += chunk_size) {
+                    std::size_t count = (std::min)(chunk_size, lhs._size - pos);
+                    std::memcpy(tmp, lhs._data + pos, count);
+                    std::memcpy(lhs._data + pos, rhs._data + pos, count);
+                    std::memcpy(rhs._data + pos, tmp, count);
+                }
+            }
+
+        private:
+
+            unsigned char* _data;
+            std::size_t _size;
+    };
+
+    class record_value
+    {
+        public:
+
+            record_value() = default;
+
+            record_value(const record_reference& ref):
+                _bytes(reinterpret_cast<const char*>(ref.data()), ref.size())
+            {}
+
+            auto data() noexcept
+                -> unsigned char*
+            {
+                return reinterpret_cast<unsigned char*>(&_bytes[0]);
+            }
+
+            auto data() const noexcept
+                -> const unsigned char*
+            {
+                return reinterpret_cast<const unsigned char*>(_bytes.data());
+            }
+
+            auto size() const noexcept
+                -> std::size_t
+            {
+                return _bytes.size();
+            }
+
+        private:
+
+            // std::string is used for its small buffer optimization
+            std::string _bytes;
+    };
+
+    inline auto record_reference::operator=(const record_value& other) noexcept
+        -> record_reference&
+    {
+        CPPSORT_ASSERT(_size == other.size());
+        std::memcpy(_data, other.data(), _size);
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Records are compared lexicographically byte per byte
+
+    namespace detail
+    {
+        template<typename T>
+        struct is_record:
+            std::integral_constant<bool,
+                std::is_same<T, record_reference>::value ||
+                std::is_same<T, record_value>::value
+            >
+        {};
+
+        template<typename T, typename U>
+        using enable_if_records_t = std::enable_if_t<
+            is_record<T>::value && is_record<U>::value,
+            bool
+        >;
+
+        inline auto compare_bytes(const unsigned char* lhs, std::size_t lhs_size,
+                                  const unsigned char* rhs, std::size_t rhs_size) noexcept
+            -> int
+        {
+            std::size_t size = (std::min)(lhs_size, rhs_size);
+            if (size != 0) {
+                if (int res = std::memcmp(lhs, rhs, size)) {
+                    return res;
+                }
+            }
+            return (lhs_size > rhs_size) - (lhs_size < rhs_size);
+        }
+    }
+
+    template<typename T, typename U>
+    auto operator==(const T& lhs, const U& rhs) noexcept
+        -> detail::enable_if_records_t<T, U>
+    {
+        return detail::compare_bytes(lhs.data(), lhs.size(), rhs.data(), rhs.size()) == 0;
+    }
+
+    template<typename T, typename U>
+    auto operator!=(const T& lhs, const U& rhs) noexcept
+        -> detail::enable_if_records_t<T, U>
+    {
+        return detail::compare_bytes(lhs.data(), lhs.size(), rhs.data(), rhs.size()) != 0;
+    }
+
+    template<typename T, typename U>
+    auto operator<(const T& lhs, const U& rhs) noexcept
+        -> detail::enable_if_records_t<T, U>
+    {
+        return detail::compare_bytes(lhs.data(), lhs.size(), rhs.data(), rhs.size()) < 0;
+    }
+
+    template<typename T, typename U>
+    auto operator>(const T& lhs, const U& rhs) noexcept
+        -> detail::enable_if_records_t<T, U>
+    {
+        return detail::compare_bytes(lhs.data(), lhs.size(), rhs.data(), rhs.size()) > 0;
+    }
+
+    template<typename T, typename U>
+    auto operator<=(const T& lhs, const U& rhs) noexcept
+        -> detail::enable_if_records_t<T, U>
+    {
+        return detail::compare_bytes(lhs.data(), lhs.size(), rhs.data(), rhs.size()) <= 0;
+    }
+
+    template<typename T, typename U>
+    auto operator>=(const T& lhs, const U& rhs) noexcept
+        -> detail::enable_if_records_t<T, U>
+    {
+        return detail::compare_bytes(lhs.data(), lhs.size(), rhs.data(), rhs.size()) >= 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // record_iterator
+
+    class record_iterator
+    {
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Public types
+
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = record_value;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = record_reference;
+
+            ////////////////////////////////////////////////////////////
+            // Constructors
+
+            record_iterator() = default;
+
+            record_iterator(void* data, std::size_t record_size) noexcept:
+                _data(static_cast<unsigned char*>(data)),
+                _record_size(record_size)
+            {
+                CPPSORT_ASSERT(record_size > 0);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Members access
+
+            auto base() const noexcept
+                -> unsigned char*
+            {
+                return _data;
+            }
+
+            auto record_size() const noexcept
+                -> std::size_t
+            {
+                return _record_size;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Element access
+
+            auto operator*() const noexcept
+                -> reference
+            {
+                return reference(_data, _record_size);
+            }
+
+            auto operator[](difference_type pos) const noexcept
+                -> reference
+            {
+                return *(*this + pos);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Increment/decrement operators
+
+            auto operator++() noexcept
+                -> record_iterator&
+            {
+                _data += _record_size;
+                return *this;
+            }
+
+            auto operator++(int) noexcept
+                -> record_iterator
+            {
+                auto tmp = *this;
+                operator++();
+                return tmp;
+            }
+
+            auto operator--() noexcept
+                -> record_iterator&
+            {
+                _data -= _record_size;
+                return *this;
+            }
+
+            auto operator--(int) noexcept
+                -> record_iterator
+            {
+                auto tmp = *this;
+                operator--();
+                return tmp;
+            }
+
+            auto operator+=(difference_type increment) noexcept
+                -> record_iterator&
+            {
+                _data += increment * static_cast<difference_type>(_record_size);
+                return *this;
+            }
+
+            auto operator-=(difference_type increment) noexcept
+                -> record_iterator&
+            {
+                _data -= increment * static_cast<difference_type>(_record_size);
+                return *this;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Comparison operators
+
+            friend auto operator==(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> bool
+            {
+                return lhs._data == rhs._data;
+            }
+
+            friend auto operator!=(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> bool
+            {
+                return lhs._data != rhs._data;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Relational operators
+
+            friend auto operator<(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> bool
+            {
+                return lhs._data < rhs._data;
+            }
+
+            friend auto operator<=(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> bool
+            {
+                return lhs._data <= rhs._data;
+            }
+
+            friend auto operator>(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> bool
+            {
+                return lhs._data > rhs._data;
+            }
+
+            friend auto operator>=(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> bool
+            {
+                return lhs._data >= rhs._data;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Arithmetic operators
+
+            friend auto operator+(record_iterator it, difference_type size) noexcept
+                -> record_iterator
+            {
+                return it += size;
+            }
+
+            friend auto operator+(difference_type size, record_iterator it) noexcept
+                -> record_iterator
+            {
+                return it += size;
+            }
+
+            friend auto operator-(record_iterator it, difference_type size) noexcept
+                -> record_iterator
+            {
+                return it -= size;
+            }
+
+            friend auto operator-(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> difference_type
+            {
+                return (lhs._data - rhs._data) / static_cast<difference_type>(lhs._record_size);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // iter_move and iter_swap
+
+            friend auto iter_move(const record_iterator& it)
+                -> value_type
+            {
+                return value_type(*it);
+            }
+
+            friend auto iter_swap(const record_iterator& lhs, const record_iterator& rhs) noexcept
+                -> void
+            {
+                swap(*lhs, *rhs);
+            }
+
+        private:
+
+            unsigned char* _data = nullptr;
+            std::size_t _record_size = 1;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Range of records over a region of memory
+
+    class record_range
+    {
+        public:
+
+            using iterator = record_iterator;
+
+            record_range(void* data, std::size_t size, std::size_t record_size) noexcept:
+                _first(data, record_size),
+                _last(static_cast<unsigned char*>(data) + size - size % record_size, record_size)
+            {
+                CPPSORT_ASSERT(size % record_size == 0);
+            }
+
+            auto begin() const noexcept
+                -> iterator
+            {
+                return _first;
+            }
+
+            auto end() const noexcept
+                -> iterator
+            {
+                return _last;
+            }
+
+            auto size() const noexcept
+                -> std::size_t
+            {
+                return static_cast<std::size_t>(_last - _first);
+            }
+
+        private:
+
+            iterator _first;
+            iterator _last;
+    };
+
+    inline auto records(void* data, std::size_t size, std::size_t record_size) noexcept
+        -> record_range
+    {
+        return record_range(data, size, record_size);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Projections extracting a key from a record
+
+    // Bytes of a record compared lexicographically, which is the
+    // natural order of big-endian integers and of text
+    class byte_view
+    {
+        public:
+
+            byte_view(const unsigned char* data, std::size_t size) noexcept:
+                _data(data),
+                _size(size)
+            {}
+
+            auto data() const noexcept
+                -> const unsigned char*
+            {
+                return _data;
+            }
+
+            auto size() const noexcept
+                -> std::size_t
+            {
+                return _size;
+            }
+
+            friend auto operator==(const byte_view& lhs, const byte_view& rhs) noexcept
+                -> bool
+            {
+                return detail::compare_bytes(lhs._data, lhs._size, rhs._data, rhs._size) == 0;
+            }
+
+            friend auto operator!=(const byte_view& lhs, const byte_view& rhs) noexcept
+                -> bool
+            {
+                return detail::compare_bytes(lhs._data, lhs._size, rhs._data, rhs._size) != 0;
+            }
+
+            friend auto operator<(const byte_view& lhs, const byte_view& rhs) noexcept
+                -> bool
+            {
+                return detail::compare_bytes(lhs._data, lhs._size, rhs._data, rhs._size) < 0;
+            }
+
+            friend auto operator>(const byte_view& lhs, const byte_view& rhs) noexcept
+                -> bool
+            {
+                return detail::compare_bytes(lhs._data, lhs._size, rhs._data, rhs._size) > 0;
+            }
+
+            friend auto operator<=(const byte_view& lhs, const byte_view& rhs) noexcept
+                -> bool
+            {
+                return detail::compare_bytes(lhs._data, lhs._size, rhs._data, rhs._size) <= 0;
+            }
+
+            friend auto operator>=(const byte_view& lhs, const byte_view& rhs) noexcept
+                -> bool
+            {
+                return detail::compare_bytes(lhs._data, lhs._size, rhs._data, rhs._size) >= 0;
+            }
+
+        private:
+
+            const unsigned char* _data;
+            std::size_t _size;
+    };
+
+    struct record_bytes:
+        projection_base
+    {
+        std::size_t offset;
+        std::size_t width;
+
+        constexpr record_bytes(std::size_t offset, std::size_t width) noexcept:
+            offset(offset),
+            width(width)
+        {}
+
+        template<typename Record>
+        auto operator()(const Record& record) const noexcept
+            -> std::enable_if_t<detail::is_record<Record>::value, byte_view>
+        {
+            CPPSORT_ASSERT(offset + width <= record.size());
+            return byte_view(record.data() + offset, width);
+        }
+    };
+
+    // Field of type T stored in native byte order, the result can
+    // be used by radix sorters when T is an integer
+    template<typename T>
+    struct record_field:
+        projection_base
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "record_field can only read trivially copyable types");
+
+        std::size_t offset;
+
+        constexpr explicit record_field(std::size_t offset) noexcept:
+            offset(offset)
+        {}
+
+        template<typename Record>
+        auto operator()(const Record& record) const noexcept
+            -> std::enable_if_t<detail::is_record<Record>::value, T>
+        {
+            CPPSORT_ASSERT(offset + sizeof(T) <= record.size());
+            T res;
+            std::memcpy(&res, record.data() + offset, sizeof(T));
+            return res;
+        }
+    };
+}}
+
+#endif // CPPSORT_UTILITY_RECORD_ITERATOR_H_
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_RESORT_H_
+#define CPPSORT_UTILITY_RESORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "../detail/config.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/move.h"
+#include "../detail/pdqsort.h"
+#include "../detail/type_traits.h"
+#include "../detail/upper_bound.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Position of the first element greater than value in the
+        // sorted range [first, last), found with an exponential
+        // search starting from last: it only takes O(log d)
+        // comparisons, d being the distance from last
+
+        template<typename RandomAccessIterator, typename T,
+                 typename Compare, typename Projection>
+        auto gallop_upper_bound_backward(RandomAccessIterator first, RandomAccessIterator last,
+                                         const T& value, Compare compare, Projection projection)
+            -> RandomAccessIterator
+        {
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            auto size = last - first;
+            auto hi = last;
+            decltype(size) step = 1;
+            while (step <= size && comp(value, proj(*(last - step)))) {
+                hi = last - step;
+                step *= 2;
+            }
+            auto lo = step <= size ? last - step : first;
+            return cppsort::detail::upper_bound(lo, hi, value,
+                                                std::move(compare), std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Same as above, but the exponential search starts from
+        // first and takes O(log d) comparisons, d being the distance
+        // from first
+
+        template<typename RandomAccessIterator, typename T,
+                 typename Compare, typename Projection>
+        auto gallop_upper_bound_forward(RandomAccessIterator first, RandomAccessIterator last,
+                                        const T& value, Compare compare, Projection projection)
+            -> RandomAccessIterator
+        {
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            auto size = last - first;
+            auto lo = first;
+            decltype(size) step = 1;
+            while (step <= size && not comp(value, proj(*(first + (step - 1))))) {
+                lo = first + step;
+                step *= 2;
+            }
+            auto hi = step <= size ? first + (step - 1) : last;
+            return cppsort::detail::upper_bound(lo, hi, value,
+                                                std::move(compare), std::move(projection));
+        }
+
+        template<typename RandomAccessIterator, typename Positions,
+                 typename Compare, typename Projection>
+        auto resort(RandomAccessIterator first, RandomAccessIterator last,
+                    const Positions& positions,
+                    Compare compare, Projection projection)
+            -> void
+        {
+            using utility::iter_move;
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+            using rvalue_reference = cppsort::detail::remove_cvref_t<
+                cppsort::detail::rvalue_reference_t<RandomAccessIterator>
+            >;
+            auto&& proj = utility::as_function(projection);
+
+            std::vector<difference_type> dirty(std::begin(positions), std::end(positions));
+            if (dirty.empty()) {
+                return;
+            }
+            std::sort(dirty.begin(), dirty.end());
+            dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+            CPPSORT_ASSERT(dirty.front() >= 0 && dirty.back() < last - first);
+
+            // Take the modified elements out, and close the gaps by
+            // moving the sorted elements between them to the left: the
+            // elements after the last modified one don't move, which
+            // leaves a hole of dirty.size() elements before them
+            std::vector<rvalue_reference> buffer;
+            buffer.reserve(dirty.size());
+            auto clean_last = first + dirty.front();
+            for (std::size_t idx = 0 ; idx < dirty.size() ; ++idx) {
+                auto it = first + dirty[idx];
+                buffer.push_back(iter_move(it));
+                if (idx + 1 < dirty.size()) {
+                    clean_last = cppsort::detail::move(it + 1, first + dirty[idx + 1], clean_last);
+                }
+            }
+            auto suffix_first = first + dirty.back() + 1;
+
+            cppsort::detail::pdqsort(buffer.begin(), buffer.end(), compare, projection);
+
+            // The modified elements greater than the first element of
+            // the suffix go to the suffix, the other ones go before it
+            auto middle = buffer.end();
+            if (suffix_first != last) {
+                middle = cppsort::detail::upper_bound(buffer.begin(), buffer.end(), proj(*suffix_first),
+                                                      compare, projection);
+            }
+            auto hole = clean_last + (middle - buffer.begin());
+
+            // Insert the elements that go to the suffix from the left,
+            // every insertion shifts a block of sorted elements of the
+            // suffix to the left at once
+            auto dest = hole;
+            for (auto it = middle ; it != buffer.end() ; ++it) {
+                auto pos = gallop_upper_bound_forward(suffix_first, last, proj(*it),
+                                                      compare, projection);
+                dest = cppsort::detail::move(suffix_first, pos, dest);
+                suffix_first = pos;
+                *dest = std::move(*it);
+                ++dest;
+            }
+
+            // Insert the other elements from the right, every insertion
+            // shifts a block of sorted elements to the right at once
+            dest = hole;
+            for (auto it = middle ; it != buffer.begin() ;) {
+                --it;
+                auto pos = gallop_upper_bound_backward(first, clean_last, proj(*it),
+                                                       compare, projection);
+                dest = cppsort::detail::move_backward(pos, clean_last, dest);
+                clean_last = pos;
+                *--dest = std::move(*it);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // resort: sort again a sorted collection in which the elements
+    // at the given positions were modified
+
+    template<
+        typename RandomAccessIterator,
+        typename Positions,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+        >
+    >
+    auto resort(RandomAccessIterator first, RandomAccessIterator last,
+                const Positions& positions,
+                Compare compare={}, Projection projection={})
+        -> void
+    {
+        static_assert(
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                cppsort::detail::iterator_category_t<RandomAccessIterator>
+            >::value,
+            "resort requires at least random-access iterators"
+        );
+
+        detail::resort(std::move(first), std::move(last), positions,
+                       std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterator,
+        typename Positions,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator> &&
+            not is_projection_iterator_v<utility::identity, RandomAccessIterator, Projection>
+        >
+    >
+    auto resort(RandomAccessIterator first, RandomAccessIterator last,
+                const Positions& positions, Projection projection)
+        -> void
+    {
+        utility::resort(std::move(first), std::move(last), positions,
+                        std::less<>{}, std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename Positions,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto resort(RandomAccessIterable&& iterable, const Positions& positions,
+                Compare compare={}, Projection projection={})
+        -> void
+    {
+        utility::resort(std::begin(iterable), std::end(iterable), positions,
+                        std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename Positions,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable> &&
+            not is_projection_v<utility::identity, RandomAccessIterable, Projection>
+        >
+    >
+    auto resort(RandomAccessIterable&& iterable, const Positions& positions,
+                Projection projection)
+        -> void
+    {
+        utility::resort(std::begin(iterable), std::end(iterable), positions,
+                        std::less<>{}, std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_RESORT_H_
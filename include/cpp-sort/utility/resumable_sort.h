@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_RESUMABLE_SORT_H_
+#define CPPSORT_UTILITY_RESUMABLE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "../detail/insertion_sort.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Stable bottom-up merge sort that can be interrupted after
+    // any number of elements and resumed later: every call to
+    // step processes a bounded number of elements, which allows
+    // to sort big collections from an event loop without blocking
+    // it for a long time
+    //
+    // Small blocks are first sorted with an insertion sort, then
+    // the runs are merged pairwise, back and forth between the
+    // collection and a buffer. When the sort is cancelled or the
+    // object destroyed before the end, the elements held by the
+    // buffer are moved back so that the collection always ends
+    // up holding all of its elements
+
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity
+    >
+    class resumable_sort
+    {
+        public:
+
+            using size_type = std::size_t;
+
+            resumable_sort(RandomAccessIterator first, RandomAccessIterator last,
+                           Compare compare={}, Projection projection={}):
+                first(first),
+                size(static_cast<size_type>(last - first)),
+                compare(std::move(compare)),
+                projection(std::move(projection))
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        cppsort::detail::iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "resumable_sort requires at least random-access iterators"
+                );
+
+                // Passes needed after the blocks are sorted, plus a
+                // last one to move the elements back from the buffer
+                bool in_buffer = false;
+                for (size_type width = block_size ; width < size || in_buffer ; width *= 2) {
+                    ++nb_passes;
+                    in_buffer = not in_buffer;
+                }
+                if (nb_passes > 0) {
+                    buffer.reserve(size);
+                }
+                current_phase = size > 1 ? phase::sort_blocks : phase::done;
+            }
+
+            resumable_sort(const resumable_sort&) = delete;
+            resumable_sort& operator=(const resumable_sort&) = delete;
+
+            ~resumable_sort()
+            {
+                restore();
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Process about max_elements elements, slightly more when
+            // a small block has to be sorted, and return whether the
+            // collection is sorted
+
+            auto step(size_type max_elements)
+                -> bool
+            {
+                // Don't overflow the work counters
+                budget = (std::min)(max_elements, size * (nb_passes + 1));
+                while (budget > 0) {
+                    if (current_phase == phase::sort_blocks) {
+                        sort_block();
+                    } else if (current_phase == phase::merge) {
+                        if (to_buffer) {
+                            merge_some<true>(first);
+                        } else {
+                            merge_some<false>(buffer.begin());
+                        }
+                    } else {
+                        break;
+                    }
+                }
+                return current_phase == phase::done;
+            }
+
+            // Whether the collection is sorted
+            auto done() const noexcept
+                -> bool
+            {
+                return current_phase == phase::done;
+            }
+
+            // Whether the sort was cancelled
+            auto cancelled() const noexcept
+                -> bool
+            {
+                return current_phase == phase::cancelled;
+            }
+
+            // Fraction of the work already done, between 0 and 1
+            auto progress() const noexcept
+                -> double
+            {
+                if (current_phase == phase::done) {
+                    return 1.0;
+                }
+                double total = static_cast<double>(size) * (nb_passes + 1);
+                return total == 0.0 ? 0.0 : static_cast<double>(work_done()) / total;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Stop sorting: the elements are left in an unspecified
+            // order, this operation is not bounded since it might have
+            // to move the elements back from the buffer
+
+            auto cancel()
+                -> void
+            {
+                if (current_phase != phase::done) {
+                    restore();
+                    current_phase = phase::cancelled;
+                }
+            }
+
+        private:
+
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+            using value_type = cppsort::detail::remove_cvref_t<
+                cppsort::detail::rvalue_reference_t<RandomAccessIterator>
+            >;
+
+            enum class phase
+            {
+                sort_blocks,
+                merge,
+                done,
+                cancelled
+            };
+
+            static constexpr size_type block_size = 32;
+
+            auto work_done() const noexcept
+                -> size_type
+            {
+                if (current_phase == phase::sort_blocks) {
+                    return block_begin;
+                }
+                return size * (passes_done + 1) + out;
+            }
+
+            auto sort_block()
+                -> void
+            {
+                size_type block_end = (std::min)(block_begin + block_size, size);
+                cppsort::detail::insertion_sort(first + difference_type(block_begin),
+                                                first + difference_type(block_end),
+                                                compare, projection);
+                budget -= (std::min)(budget, block_end - block_begin);
+                block_begin = block_end;
+                if (block_begin == size) {
+                    start_pass(block_size);
+                }
+            }
+
+            auto start_pass(size_type new_width)
+                -> void
+            {
+                width = new_width;
+                if (width >= size && to_buffer) {
+                    // The sorted elements are in the collection
+                    current_phase = phase::done;
+                    buffer.clear();
+                    return;
+                }
+                current_phase = phase::merge;
+                start_runs(0);
+            }
+
+            auto start_runs(size_type begin)
+                -> void
+            {
+                lo = out = i = begin;
+                mid = j = (std::min)(begin + width, size);
+                hi = (std::min)(mid + width, size);
+            }
+
+            // Write the next merged element to its destination: the
+            // first pass from the collection constructs the elements
+            // of the buffer
+            template<typename Value>
+            auto put(std::true_type /* to buffer */, Value&& value)
+                -> void
+            {
+                if (out < buffer.size()) {
+                    buffer[out] = std::forward<Value>(value);
+                } else {
+                    buffer.push_back(std::forward<Value>(value));
+                }
+            }
+
+            template<typename Value>
+            auto put(std::false_type /* to buffer */, Value&& value)
+                -> void
+            {
+                first[difference_type(out)] = std::forward<Value>(value);
+            }
+
+            template<bool ToBuffer, typename Iterator>
+            auto merge_some(Iterator src)
+                -> void
+            {
+                using utility::iter_move;
+                using to_buffer_t = std::integral_constant<bool, ToBuffer>;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                while (budget > 0) {
+                    --budget;
+                    auto it_i = src + difference_type(i);
+                    auto it_j = src + difference_type(j);
+                    // Take the element from the left run on ties
+                    if (j == hi || (i != mid && not comp(proj(*it_j), proj(*it_i)))) {
+                        put(to_buffer_t{}, iter_move(it_i));
+                        ++i;
+                    } else {
+                        put(to_buffer_t{}, iter_move(it_j));
+                        ++j;
+                    }
+                    ++out;
+
+                    if (i == mid && j == hi) {
+                        if (hi == size) {
+                            // End of the pass, the destination becomes
+                            // the source of the next one
+                            to_buffer = not to_buffer;
+                            ++passes_done;
+                            out = 0;
+                            start_pass(width * 2);
+                            return;
+                        }
+                        start_runs(hi);
+                    }
+                }
+            }
+
+            // Move the elements held by the buffer back to the slots
+            // of the collection they left
+            auto restore()
+                -> void
+            {
+                if (current_phase != phase::merge) {
+                    return;
+                }
+
+                auto buff = buffer.begin();
+                if (to_buffer) {
+                    // The merged elements come from the consumed slots
+                    // of the collection: [0, i) and [mid, j)
+                    auto dest = std::move(buff, buff + difference_type(i), first);
+                    std::move(buff + difference_type(i), buff + difference_type(out),
+                              dest + difference_type(mid - i));
+                } else {
+                    // The collection misses the elements not merged yet
+                    auto dest = first + difference_type(out);
+                    dest = std::move(buff + difference_type(i), buff + difference_type(mid), dest);
+                    std::move(buff + difference_type(j), buff + difference_type(size), dest);
+                }
+                buffer.clear();
+                current_phase = phase::cancelled;
+            }
+
+            RandomAccessIterator first;
+            size_type size;
+            Compare compare;
+            Projection projection;
+            std::vector<value_type> buffer;
+
+            phase current_phase = phase::done;
+            size_type nb_passes = 0;
+            size_type passes_done = 0;
+            size_type budget = 0;
+
+            // State of the block sorting phase
+            size_type block_begin = 0;
+
+            // State of the merge phase: the runs [lo, mid) and [mid, hi)
+            // are merged, i and j being the next elements to merge and
+            // out the position where they go
+            bool to_buffer = true;
+            size_type width = 0;
+            size_type lo = 0;
+            size_type mid = 0;
+            size_type hi = 0;
+            size_type i = 0;
+            size_type j = 0;
+            size_type out = 0;
+    };
+}}
+
+#endif // CPPSORT_UTILITY_RESUMABLE_SORT_H_
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_SORT_PERMUTATION_H_
+#define CPPSORT_UTILITY_SORT_PERMUTATION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include "../detail/config.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/ska_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Access to the elements of a collection from their index:
+        // random-access iterators are used directly while the other
+        // iterators are first gathered into a vector
+
+        template<typename RandomAccessIterator>
+        auto make_index_access(std::random_access_iterator_tag,
+                               RandomAccessIterator first, RandomAccessIterator)
+            -> RandomAccessIterator
+        {
+            return first;
+        }
+
+        template<typename ForwardIterator>
+        struct iterators_access
+        {
+            std::vector<ForwardIterator> iterators;
+
+            auto operator[](std::size_t pos) const
+                -> decltype(*iterators[pos])
+            {
+                return *iterators[pos];
+            }
+        };
+
+        template<typename ForwardIterator>
+        auto make_index_access(std::forward_iterator_tag,
+                               ForwardIterator first, ForwardIterator last)
+            -> iterators_access<ForwardIterator>
+        {
+            iterators_access<ForwardIterator> res;
+            for (; first != last ; ++first) {
+                res.iterators.push_back(first);
+            }
+            return res;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Projections from the indices to the keys
+
+        template<typename Access, typename Projection>
+        struct index_projection
+        {
+            const Access& access;
+            Projection projection;
+
+            template<typename Index>
+            auto operator()(Index pos) const
+                -> decltype(utility::as_function(projection)(access[pos]))
+            {
+                return utility::as_function(projection)(access[pos]);
+            }
+        };
+
+        template<typename IndexProjection>
+        struct index_pair_projection
+        {
+            IndexProjection projection;
+
+            template<typename Index>
+            auto operator()(Index pos) const
+                -> std::pair<cppsort::detail::remove_cvref_t<decltype(projection(pos))>, Index>
+            {
+                return { projection(pos), pos };
+            }
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Stable comparison of the indices: equivalent keys are
+        // ordered by index
+
+        template<typename Compare, typename IndexProjection>
+        struct index_stable_compare
+        {
+            Compare compare;
+            IndexProjection projection;
+
+            template<typename Index>
+            auto operator()(Index lhs, Index rhs)
+                -> bool
+            {
+                auto&& comp = utility::as_function(compare);
+                auto&& lhs_key = projection(lhs);
+                auto&& rhs_key = projection(rhs);
+                if (comp(lhs_key, rhs_key)) {
+                    return true;
+                }
+                if (comp(rhs_key, lhs_key)) {
+                    return false;
+                }
+                return lhs < rhs;
+            }
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Keys cheap enough to be copied along with the indices so
+        // that they can be sorted with a radix sort: ties are then
+        // broken by the index itself
+
+        template<typename Compare, typename Key, typename Index>
+        struct is_index_pair_sortable:
+            std::integral_constant<bool,
+                std::is_same<Compare, std::less<>>::value &&
+                std::is_arithmetic<Key>::value &&
+                cppsort::detail::is_ska_sortable_v<std::pair<Key, Index>>
+            >
+        {};
+
+        ////////////////////////////////////////////////////////////
+        // Sort the indices
+
+        template<typename Index, typename Size>
+        auto make_indices(Size size)
+            -> std::vector<Index>
+        {
+            // Indices past the maximum value of Index would wrap
+            // around and silently produce a wrong permutation
+            bool fits = static_cast<std::uintmax_t>(size) <=
+                        static_cast<std::uintmax_t>(std::numeric_limits<Index>::max());
+            CPPSORT_ASSERT(fits);
+            if (not fits) {
+                throw std::length_error("sort_permutation: Index can't represent every position");
+            }
+
+            std::vector<Index> indices(size);
+            std::iota(indices.begin(), indices.end(), Index(0));
+            return indices;
+        }
+
+        template<typename Sorter, typename Index, typename Compare, typename IndexProjection>
+        auto stable_sort_indices(std::true_type, const Sorter& sorter,
+                                 std::vector<Index>& indices,
+                                 Compare compare, IndexProjection projection)
+            -> void
+        {
+            // Radix-friendly keys: sort (key, index) pairs
+            sorter(indices, std::move(compare),
+                   index_pair_projection<IndexProjection>{std::move(projection)});
+        }
+
+        template<typename Sorter, typename Index, typename Compare, typename IndexProjection>
+        auto stable_sort_indices(std::false_type, const Sorter& sorter,
+                                 std::vector<Index>& indices,
+                                 Compare compare, IndexProjection projection)
+            -> void
+        {
+            sorter(indices, index_stable_compare<Compare, IndexProjection>{
+                std::move(compare), std::move(projection)
+            });
+        }
+
+        template<typename Sorter, typename Index, typename Compare, typename IndexProjection>
+        auto sort_indices(std::false_type /* stable */, const Sorter& sorter,
+                          std::vector<Index>& indices,
+                          Compare compare, IndexProjection projection)
+            -> void
+        {
+            sorter(indices, std::move(compare), std::move(projection));
+        }
+
+        template<typename Sorter, typename Index, typename Compare, typename IndexProjection>
+        auto sort_indices_stably(std::true_type /* stable sorter */, const Sorter& sorter,
+                                 std::vector<Index>& indices,
+                                 Compare compare, IndexProjection projection)
+            -> void
+        {
+            sorter(indices, std::move(compare), std::move(projection));
+        }
+
+        template<typename Sorter, typename Index, typename Compare, typename IndexProjection>
+        auto sort_indices_stably(std::false_type /* stable sorter */, const Sorter& sorter,
+                                 std::vector<Index>& indices,
+                                 Compare compare, IndexProjection projection)
+            -> void
+        {
+            using key_type = cppsort::detail::remove_cvref_t<decltype(projection(Index(0)))>;
+            stable_sort_indices(is_index_pair_sortable<Compare, key_type, Index>{},
+                                sorter, indices, std::move(compare), std::move(projection));
+        }
+
+        template<typename Sorter, typename Index, typename Compare, typename IndexProjection>
+        auto sort_indices(std::true_type /* stable */, const Sorter& sorter,
+                          std::vector<Index>& indices,
+                          Compare compare, IndexProjection projection)
+            -> void
+        {
+            using is_stable_t = cppsort::is_stable<
+                Sorter(std::vector<Index>&, Compare, IndexProjection)
+            >;
+            sort_indices_stably(std::integral_constant<bool, is_stable_t::value>{},
+                                sorter, indices, std::move(compare), std::move(projection));
+        }
+
+        template<
+            typename Index,
+            bool Stable,
+            typename Sorter,
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection
+        >
+        auto sort_permutation(const Sorter& sorter,
+                              ForwardIterator first, ForwardIterator last,
+                              cppsort::detail::difference_type_t<ForwardIterator> size,
+                              Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            auto access = make_index_access(
+                cppsort::detail::iterator_category_t<ForwardIterator>{},
+                std::move(first), std::move(last)
+            );
+            using index_proj_t = index_projection<decltype(access), Projection>;
+
+            auto indices = make_indices<Index>(size);
+            sort_indices(std::integral_constant<bool, Stable>{}, sorter, indices,
+                         std::move(compare), index_proj_t{ access, std::move(projection) });
+            return indices;
+        }
+
+        template<
+            typename Index,
+            bool Stable,
+            typename Sorter,
+            typename Iterable,
+            typename Compare,
+            typename Projection
+        >
+        auto sort_permutation(const Sorter& sorter, Iterable& iterable,
+                              Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            return sort_permutation<Index, Stable>(sorter,
+                                                   std::begin(iterable), std::end(iterable),
+                                                   utility::size(iterable),
+                                                   std::move(compare), std::move(projection));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // sort_permutation
+
+    template<
+        typename Index = std::uint32_t,
+        typename Sorter,
+        typename Iterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<is_projection_v<Projection, Iterable, Compare>>
+    >
+    auto sort_permutation(const Sorter& sorter, Iterable&& iterable,
+                          Compare compare={}, Projection projection={})
+        -> std::vector<Index>
+    {
+        return detail::sort_permutation<Index, false>(sorter, iterable,
+                                                      std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename Index = std::uint32_t,
+        typename Sorter,
+        typename Iterable,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_v<Projection, Iterable> &&
+            not is_projection_v<utility::identity, Iterable, Projection>
+        >
+    >
+    auto sort_permutation(const Sorter& sorter, Iterable&& iterable, Projection projection)
+        -> std::vector<Index>
+    {
+        return detail::sort_permutation<Index, false>(sorter, iterable,
+                                                      std::less<>{}, std::move(projection));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // stable_sort_permutation
+
+    template<
+        typename Index = std::uint32_t,
+        typename Sorter,
+        typename Iterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = std::enable_if_t<is_projection_v<Projection, Iterable, Compare>>
+    >
+    auto stable_sort_permutation(const Sorter& sorter, Iterable&& iterable,
+                                 Compare compare={}, Projection projection={})
+        -> std::vector<Index>
+    {
+        return detail::sort_permutation<Index, true>(sorter, iterable,
+                                                     std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename Index = std::uint32_t,
+        typename Sorter,
+        typename Iterable,
+        typename Projection,
+        typename = std::enable_if_t<
+            is_projection_v<Projection, Iterable> &&
+            not is_projection_v<utility::identity, Iterable, Projection>
+        >
+    >
+    auto stable_sort_permutation(const Sorter& sorter, Iterable&& iterable, Projection projection)
+        -> std::vector<Index>
+    {
+        return detail::sort_permutation<Index, true>(sorter, iterable,
+                                                     std::less<>{}, std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_SORT_PERMUTATION_H_
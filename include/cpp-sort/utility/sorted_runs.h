@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_SORTED_RUNS_H_
+#define CPPSORT_UTILITY_SORTED_RUNS_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/inplace_merge.h"
+#include "../detail/kway_merge.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Collection of elements received in batches: every batch is
+    // sorted with the given sorter when it arrives, and the sorted
+    // runs are kept in a single vector, each run being more than
+    // twice as big as the next one, which keeps their number
+    // logarithmic. The smallest elements can be read by merging
+    // the heads of the runs, and the merges needed to get a fully
+    // sorted collection are only performed when it is asked for
+
+    template<
+        typename T,
+        typename Sorter,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity
+    >
+    class sorted_runs
+    {
+        public:
+
+            using value_type = T;
+            using size_type = std::size_t;
+            using const_iterator = typename std::vector<T>::const_iterator;
+
+            explicit sorted_runs(Sorter sorter={}, Compare compare={},
+                                 Projection projection={}):
+                sorter(std::move(sorter)),
+                compare(std::move(compare)),
+                projection(std::move(projection))
+            {}
+
+            ////////////////////////////////////////////////////////////
+            // Add a batch of elements
+
+            template<typename InputIterator>
+            auto push(InputIterator first, InputIterator last)
+                -> void
+            {
+                auto old_size = elements.size();
+                elements.insert(elements.end(), first, last);
+                if (elements.size() == old_size) {
+                    return;
+                }
+                sorter(elements.begin() + old_size, elements.end(), compare, projection);
+                run_ends.push_back(elements.size());
+                collapse();
+            }
+
+            template<typename Iterable>
+            auto push(const Iterable& batch)
+                -> void
+            {
+                push(std::begin(batch), std::end(batch));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Copy the m smallest elements in sorted order to out, the
+            // runs are left untouched
+
+            template<typename OutputIterator>
+            auto copy_smallest(size_type m, OutputIterator out) const
+                -> OutputIterator
+            {
+                m = (std::min)(m, elements.size());
+
+                // No run has to be read past its first m elements
+                std::vector<std::pair<const_iterator, const_iterator>> runs;
+                runs.reserve(run_ends.size());
+                size_type run_begin = 0;
+                for (size_type run_end: run_ends) {
+                    size_type run_size = (std::min)(run_end - run_begin, m);
+                    runs.emplace_back(elements.begin() + run_begin,
+                                      elements.begin() + (run_begin + run_size));
+                    run_begin = run_end;
+                }
+
+                cppsort::detail::loser_tree<const_iterator, Compare, Projection> tree(
+                    runs.data(), runs.data() + runs.size(), compare, projection
+                );
+                for (; m > 0 && tree.size() > 1 ; --m) {
+                    *out = *tree.top().first;
+                    ++out;
+                    tree.pop();
+                }
+                if (m > 0) {
+                    out = std::copy_n(tree.top().first, m, std::move(out));
+                }
+                return out;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Merge the remaining runs and return the sorted elements
+
+            auto sorted()
+                -> const std::vector<T>&
+            {
+                while (run_ends.size() > 1) {
+                    merge_last_runs();
+                }
+                return elements;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Miscellaneous functions
+
+            auto size() const noexcept
+                -> size_type
+            {
+                return elements.size();
+            }
+
+            auto empty() const noexcept
+                -> bool
+            {
+                return elements.empty();
+            }
+
+            // Number of sorted runs that haven't been merged yet
+            auto runs_count() const noexcept
+                -> size_type
+            {
+                return run_ends.size();
+            }
+
+            auto clear() noexcept
+                -> void
+            {
+                elements.clear();
+                run_ends.clear();
+            }
+
+        private:
+
+            // Merge the last runs until every run is more than twice
+            // as big as the next one
+            auto collapse()
+                -> void
+            {
+                while (run_ends.size() > 1) {
+                    auto nb_runs = run_ends.size();
+                    size_type last_size = run_ends[nb_runs - 1] - run_ends[nb_runs - 2];
+                    size_type prev_begin = nb_runs > 2 ? run_ends[nb_runs - 3] : 0;
+                    if (run_ends[nb_runs - 2] - prev_begin > 2 * last_size) {
+                        break;
+                    }
+                    merge_last_runs();
+                }
+            }
+
+            auto merge_last_runs()
+                -> void
+            {
+                auto nb_runs = run_ends.size();
+                size_type prev_begin = nb_runs > 2 ? run_ends[nb_runs - 3] : 0;
+                cppsort::detail::inplace_merge(elements.begin() + prev_begin,
+                                               elements.begin() + run_ends[nb_runs - 2],
+                                               elements.end(),
+                                               compare, projection);
+                run_ends.erase(run_ends.end() - 2);
+            }
+
+            // Sorted runs stored one after the other
+            std::vector<T> elements;
+            // End of every run in elements
+            std::vector<size_type> run_ends;
+            Sorter sorter;
+            Compare compare;
+            Projection projection;
+    };
+}}
+
+#endif // CPPSORT_UTILITY_SORTED_RUNS_H_
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_ZIP_H_
+#define CPPSORT_UTILITY_ZIP_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include <cpp-sort/utility/size.h>
+#include "../detail/config.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    //
+    // zip_iterator walks several random-access sequences in
+    // lockstep: dereferencing it returns a tuple of references
+    // to the elements of every sequence at the same position,
+    // and moving or swapping elements through it moves or swaps
+    // the elements of every sequence, which allows to sort
+    // parallel columns together without materializing a
+    // collection of tuples
+    //
+    // iter_move returns a tuple of values, which is also the
+    // value_type of the iterator: sorters can store it in
+    // temporaries or buffers and move it back to the sequences
+    //
+
+    template<typename... Iterators>
+    class zip_iterator
+    {
+        static_assert(sizeof...(Iterators) > 0,
+                      "zip_iterator needs at least one iterator");
+        static_assert(
+            cppsort::detail::conjunction<
+                std::is_base_of<
+                    std::random_access_iterator_tag,
+                    cppsort::detail::iterator_category_t<Iterators>
+                >...
+            >::value,
+            "zip_iterator only works with random-access iterators"
+        );
+
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Public types
+
+            using iterator_category = std::random_access_iterator_tag;
+            using iterator_type     = std::tuple<Iterators...>;
+            using value_type        = std::tuple<cppsort::detail::value_type_t<Iterators>...>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = std::tuple<cppsort::detail::reference_t<Iterators>...>;
+
+            ////////////////////////////////////////////////////////////
+            // Constructors
+
+            zip_iterator() = default;
+
+            explicit zip_iterator(Iterators... its):
+                _its(std::move(its)...)
+            {}
+
+            ////////////////////////////////////////////////////////////
+            // Members access
+
+            auto base() const
+                -> const iterator_type&
+            {
+                return _its;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Element access
+
+            auto operator*() const
+                -> reference
+            {
+                return dereference(std::index_sequence_for<Iterators...>{});
+            }
+
+            auto operator[](difference_type pos) const
+                -> reference
+            {
+                return *(*this + pos);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Increment/decrement operators
+
+            auto operator++()
+                -> zip_iterator&
+            {
+                return *this += 1;
+            }
+
+            auto operator++(int)
+                -> zip_iterator
+            {
+                auto tmp = *this;
+                operator++();
+                return tmp;
+            }
+
+            auto operator--()
+                -> zip_iterator&
+            {
+                return *this -= 1;
+            }
+
+            auto operator--(int)
+                -> zip_iterator
+            {
+                auto tmp = *this;
+                operator--();
+                return tmp;
+            }
+
+            auto operator+=(difference_type increment)
+                -> zip_iterator&
+            {
+                advance(increment, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            auto operator-=(difference_type increment)
+                -> zip_iterator&
+            {
+                advance(-increment, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Comparison operators: all the iterators move in
+            // lockstep, comparing the first ones is enough
+
+            friend auto operator==(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs._its) == std::get<0>(rhs._its);
+            }
+
+            friend auto operator!=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs._its) != std::get<0>(rhs._its);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Relational operators
+
+            friend auto operator<(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs._its) < std::get<0>(rhs._its);
+            }
+
+            friend auto operator<=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs._its) <= std::get<0>(rhs._its);
+            }
+
+            friend auto operator>(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs._its) > std::get<0>(rhs._its);
+            }
+
+            friend auto operator>=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs._its) >= std::get<0>(rhs._its);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Arithmetic operators
+
+            friend auto operator+(zip_iterator it, difference_type size)
+                -> zip_iterator
+            {
+                return it += size;
+            }
+
+            friend auto operator+(difference_type size, zip_iterator it)
+                -> zip_iterator
+            {
+                return it += size;
+            }
+
+            friend auto operator-(zip_iterator it, difference_type size)
+                -> zip_iterator
+            {
+                return it -= size;
+            }
+
+            friend auto operator-(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> difference_type
+            {
+                return std::get<0>(lhs._its) - std::get<0>(rhs._its);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // iter_move and iter_swap
+
+            friend auto iter_move(const zip_iterator& it)
+                -> value_type
+            {
+                return it.move_elements(std::index_sequence_for<Iterators...>{});
+            }
+
+            friend auto iter_swap(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> void
+            {
+                lhs.swap_elements(rhs, std::index_sequence_for<Iterators...>{});
+            }
+
+        private:
+
+            template<std::size_t... Indices>
+            auto dereference(std::index_sequence<Indices...>) const
+                -> reference
+            {
+                return reference(*std::get<Indices>(_its)...);
+            }
+
+            template<std::size_t... Indices>
+            auto advance(difference_type increment, std::index_sequence<Indices...>)
+                -> void
+            {
+                (void) std::initializer_list<int>{
+                    (std::get<Indices>(_its) += increment, 0)...
+                };
+            }
+
+            template<std::size_t... Indices>
+            auto move_elements(std::index_sequence<Indices...>) const
+                -> value_type
+            {
+                using utility::iter_move;
+                return value_type(iter_move(std::get<Indices>(_its))...);
+            }
+
+            template<std::size_t... Indices>
+            auto swap_elements(const zip_iterator& other, std::index_sequence<Indices...>) const
+                -> void
+            {
+                using utility::iter_swap;
+                (void) std::initializer_list<int>{
+                    (iter_swap(std::get<Indices>(_its), std::get<Indices>(other._its)), 0)...
+                };
+            }
+
+            iterator_type _its;
+    };
+
+    template<typename... Iterators>
+    auto make_zip_iterator(Iterators... its)
+        -> zip_iterator<Iterators...>
+    {
+        return zip_iterator<Iterators...>(std::move(its)...);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Range of zip iterators over several iterables that have
+    // the same size
+
+    template<typename... Iterators>
+    class zip_range
+    {
+        public:
+
+            using iterator = zip_iterator<Iterators...>;
+
+            zip_range(iterator first, iterator last):
+                _first(std::move(first)),
+                _last(std::move(last))
+            {}
+
+            auto begin() const
+                -> iterator
+            {
+                return _first;
+            }
+
+            auto end() const
+                -> iterator
+            {
+                return _last;
+            }
+
+            auto size() const
+                -> std::size_t
+            {
+                return static_cast<std::size_t>(_last - _first);
+            }
+
+        private:
+
+            iterator _first;
+            iterator _last;
+    };
+
+    namespace detail
+    {
+        template<typename Size>
+        auto have_size(Size)
+            -> bool
+        {
+            return true;
+        }
+
+        template<typename Size, typename Iterable, typename... Iterables>
+        auto have_size(Size size, const Iterable& iterable, const Iterables&... iterables)
+            -> bool
+        {
+            return utility::size(iterable) == size && have_size(size, iterables...);
+        }
+    }
+
+    template<typename Iterable, typename... Iterables>
+    auto zip(Iterable& iterable, Iterables&... iterables)
+        -> zip_range<
+            cppsort::detail::remove_cvref_t<decltype(std::begin(iterable))>,
+            cppsort::detail::remove_cvref_t<decltype(std::begin(iterables))>...
+        >
+    {
+        auto size = utility::size(iterable);
+        CPPSORT_ASSERT(detail::have_size(size, iterables...));
+
+        return {
+            make_zip_iterator(std::begin(iterable), std::begin(iterables)...),
+            make_zip_iterator(std::begin(iterable) + size, std::begin(iterables) + size...)
+        };
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Projection returning one of the elements of a tuple, which
+    // can be used to sort zipped sequences on one of them
+
+    template<std::size_t Index>
+    struct zip_element:
+        projection_base
+    {
+        template<typename Tuple>
+        constexpr auto operator()(Tuple&& tuple) const
+            -> decltype(std::get<Index>(std::forward<Tuple>(tuple)))
+        {
+            return std::get<Index>(std::forward<Tuple>(tuple));
+        }
+    };
+}}
+
+#endif // CPPSORT_UTILITY_ZIP_H_
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/auto_indirect_adapter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <testing-tools/algorithm.h>
+
+namespace
+{
+    // Trivially copyable and big enough to be sorted indirectly
+    struct big_record
+    {
+        int key;
+        int index;
+        std::array<char, 400> payload;
+    };
+
+    // Not trivially copyable, hence more expensive to move
+    struct named_record
+    {
+        std::string name;
+        int index;
+        std::array<char, 200> payload;
+    };
+
+    // Sizes around the measured crossovers
+    struct medium_record
+    {
+        int key;
+        std::array<char, 188> payload;
+    };
+
+    struct small_named_record
+    {
+        std::string name;
+        int key;
+        int index;
+    };
+
+    template<typename Iterator, typename Compare, typename Projection>
+    constexpr auto strategy()
+        -> cppsort::detail::indirection_strategy
+    {
+        return cppsort::detail::select_indirection_strategy<
+            Iterator, Compare, Projection, 256, 192
+        >();
+    }
+}
+
+TEST_CASE( "auto_indirect_adapter strategies", "[auto_indirect_adapter]" )
+{
+    using cppsort::detail::indirection_strategy;
+    using big_it = std::vector<big_record>::iterator;
+    using named_it = std::vector<named_record>::iterator;
+    using int_proj = decltype(&big_record::key);
+    using name_proj = decltype(&named_record::name);
+
+    static_assert(strategy<std::vector<int>::iterator, std::less<>, cppsort::utility::identity>()
+                  == indirection_strategy::in_place, "");
+    static_assert(strategy<big_it, std::less<>, int_proj>()
+                  == indirection_strategy::key_index_radix, "");
+    static_assert(strategy<big_it, std::greater<>, int_proj>()
+                  == indirection_strategy::indirect, "");
+    static_assert(strategy<std::list<big_record>::iterator, std::less<>, int_proj>()
+                  == indirection_strategy::indirect, "");
+    static_assert(strategy<named_it, std::less<>, name_proj>()
+                  == indirection_strategy::indirect, "");
+    static_assert(strategy<std::vector<medium_record>::iterator, std::less<>, decltype(&medium_record::key)>()
+                  == indirection_strategy::in_place, "");
+    static_assert(strategy<std::vector<small_named_record>::iterator, std::less<>,
+                           decltype(&small_named_record::key)>()
+                  == indirection_strategy::key_index_radix, "");
+    static_assert(strategy<std::vector<small_named_record>::iterator, std::less<>,
+                           decltype(&small_named_record::name)>()
+                  == indirection_strategy::in_place, "");
+    static_assert(cppsort::detail::select_indirection_strategy<
+                      big_it, std::less<>, int_proj, 1024, 1024
+                  >() == indirection_strategy::in_place, "");
+}
+
+TEST_CASE( "auto_indirect_adapter tests", "[auto_indirect_adapter]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    std::vector<big_record> records;
+    for (int i = 0 ; i < 1000 ; ++i) {
+        records.push_back({ static_cast<int>(engine() % 100) - 50, i, {} });
+        records.back().payload.fill(static_cast<char>(records.back().key));
+    }
+
+    auto is_consistent = [](const big_record& rec) {
+        return std::all_of(rec.payload.begin(), rec.payload.end(), [&rec](char c) {
+            return c == static_cast<char>(rec.key);
+        });
+    };
+
+    SECTION( "key and index radix sort" )
+    {
+        cppsort::auto_indirect_adapter<cppsort::pdq_sorter> sorter;
+        sorter(records, &big_record::key);
+        CHECK( std::is_sorted(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.index < rhs.index);
+        }) );
+        CHECK( std::all_of(records.begin(), records.end(), is_consistent) );
+    }
+
+    SECTION( "indirect sort" )
+    {
+        cppsort::auto_indirect_adapter<cppsort::pdq_sorter> sorter;
+        sorter(records, std::greater<>{}, &big_record::key);
+        CHECK( helpers::is_sorted(records.begin(), records.end(), std::greater<>{}, &big_record::key) );
+        CHECK( std::all_of(records.begin(), records.end(), is_consistent) );
+
+        std::vector<named_record> named;
+        for (int i = 0 ; i < 1000 ; ++i) {
+            named.push_back({ std::to_string(engine() % 100), i, {} });
+        }
+        cppsort::auto_indirect_adapter<cppsort::merge_sorter> stable_sorter;
+        stable_sorter(named, &named_record::name);
+        CHECK( std::is_sorted(named.begin(), named.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.name < rhs.name || (lhs.name == rhs.name && lhs.index < rhs.index);
+        }) );
+    }
+
+    SECTION( "bidirectional iterators" )
+    {
+        std::list<big_record> li(records.begin(), records.end());
+        cppsort::auto_indirect_adapter<cppsort::merge_sorter> sorter;
+        sorter(li, &big_record::key);
+        CHECK( helpers::is_sorted(li.begin(), li.end(), std::less<>{}, &big_record::key) );
+    }
+
+    SECTION( "in-place sort" )
+    {
+        std::vector<int> collection;
+        for (int i = 0 ; i < 1000 ; ++i) {
+            collection.push_back(static_cast<int>(engine() % 1000));
+        }
+        cppsort::auto_indirect_adapter<cppsort::pdq_sorter> sorter;
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        cppsort::auto_indirect_adapter<cppsort::pdq_sorter, 1024, 1024> large_threshold_sorter;
+        large_threshold_sorter(records, &big_record::key);
+        CHECK( helpers::is_sorted(records.begin(), records.end(), std::less<>{}, &big_record::key) );
+    }
+}
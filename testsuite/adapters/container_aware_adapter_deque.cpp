@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/container_aware_adapter.h>
+#include <cpp-sort/adapters/counting_adapter.h>
+#include <cpp-sort/sorters.h>
+#include <testing-tools/distributions.h>
+
+TEMPLATE_TEST_CASE( "container_aware_adapter and std::deque", "[container_aware_adapter]",
+                    cppsort::heap_sorter,
+                    cppsort::insertion_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::selection_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::tim_sorter,
+                    cppsort::verge_sorter )
+{
+    std::vector<double> vec;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(vec), 1187, -24.0);
+
+    cppsort::container_aware_adapter<TestType> sorter;
+    std::deque<double> collection(vec.begin(), vec.end());
+
+    sorter(collection);
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+    collection.assign(vec.begin(), vec.end());
+    sorter(collection, std::greater<>{});
+    CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+    collection.assign(vec.begin(), vec.end());
+    sorter(collection, std::negate<>{});
+    CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+    collection.assign(vec.begin(), vec.end());
+    sorter(collection, std::greater<>{}, std::negate<>{});
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+}
+
+TEST_CASE( "container_aware_adapter and std::deque specifics",
+           "[container_aware_adapter]" )
+{
+    std::vector<int> vec;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(vec), 1000, 0);
+
+    SECTION( "non-trivial elements" )
+    {
+        std::deque<std::string> collection;
+        for (int value: vec) {
+            collection.push_back(std::to_string(value));
+        }
+        auto copy = std::vector<std::string>(collection.begin(), collection.end());
+        std::sort(copy.begin(), copy.end());
+
+        cppsort::container_aware_adapter<cppsort::pdq_sorter>{}(collection);
+        CHECK( std::equal(collection.begin(), collection.end(), copy.begin(), copy.end()) );
+    }
+
+    SECTION( "empty deque" )
+    {
+        std::deque<int> collection;
+        cppsort::container_aware_adapter<cppsort::pdq_sorter>{}(collection);
+        CHECK( collection.empty() );
+    }
+
+    SECTION( "return value forwarding" )
+    {
+        std::deque<int> collection(vec.begin(), vec.end());
+        cppsort::container_aware_adapter<
+            cppsort::counting_adapter<cppsort::heap_sorter>
+        > sorter;
+        auto count = sorter(collection);
+        CHECK( count > 0 );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "stability" )
+    {
+        using stable_sorter = cppsort::container_aware_adapter<cppsort::merge_sorter>;
+        using unstable_sorter = cppsort::container_aware_adapter<cppsort::heap_sorter>;
+        static_assert(cppsort::is_stable<stable_sorter(std::deque<int>&)>::value, "");
+        static_assert(not cppsort::is_stable<unstable_sorter(std::deque<int>&)>::value, "");
+
+        std::deque<std::pair<int, int>> collection;
+        for (int i = 0 ; i < 1000 ; ++i) {
+            collection.emplace_back(vec[i] % 10, i);
+        }
+        stable_sorter{}(collection, &std::pair<int, int>::first);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/container_aware_adapter.h>
+#include <cpp-sort/adapters/counting_adapter.h>
+#include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/sorters.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    // Values that count how many times they are moved
+    struct move_counter
+    {
+        explicit move_counter(int value, int& moves):
+            value(value),
+            moves(&moves)
+        {}
+
+        move_counter(move_counter&& other):
+            value(other.value),
+            moves(other.moves)
+        {
+            ++*moves;
+        }
+
+        auto operator=(move_counter&& other)
+            -> move_counter&
+        {
+            value = other.value;
+            moves = other.moves;
+            ++*moves;
+            return *this;
+        }
+
+        int value;
+        int* moves;
+    };
+
+    // Comparison which throws after a given number of calls
+    struct throwing_less
+    {
+        int* remaining;
+
+        auto operator()(double lhs, double rhs) const
+            -> bool
+        {
+            if (--*remaining == 0) {
+                throw std::runtime_error("comparison failed");
+            }
+            return lhs < rhs;
+        }
+    };
+}
+
+TEMPLATE_TEST_CASE( "container_aware_adapter and out_of_place_adapter with lists",
+                    "[container_aware_adapter][out_of_place_adapter]",
+                    cppsort::heap_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::poplar_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::smooth_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::tim_sorter,
+                    cppsort::verge_sorter )
+{
+    std::vector<double> vec;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(vec), 1187, -24.0);
+
+    cppsort::container_aware_adapter<
+        cppsort::out_of_place_adapter<TestType>
+    > sorter;
+
+    SECTION( "std::list" )
+    {
+        std::list<double> collection(vec.begin(), vec.end());
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        collection.assign(vec.begin(), vec.end());
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+        collection.assign(vec.begin(), vec.end());
+        sorter(collection, std::negate<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+        collection.assign(vec.begin(), vec.end());
+        sorter(collection, std::greater<>{}, std::negate<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "std::forward_list" )
+    {
+        std::forward_list<double> collection(vec.begin(), vec.end());
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        collection.assign(vec.begin(), vec.end());
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+        collection.assign(vec.begin(), vec.end());
+        sorter(collection, std::negate<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+        collection.assign(vec.begin(), vec.end());
+        sorter(collection, std::greater<>{}, std::negate<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
+
+TEST_CASE( "container_aware_adapter and out_of_place_adapter specifics",
+           "[container_aware_adapter][out_of_place_adapter]" )
+{
+    std::vector<int> vec;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(vec), 1000, 0);
+
+    cppsort::container_aware_adapter<
+        cppsort::out_of_place_adapter<cppsort::pdq_sorter>
+    > sorter;
+
+    SECTION( "nodes are relinked" )
+    {
+        std::list<int> collection(vec.begin(), vec.end());
+        std::vector<const int*> addresses;
+        for (auto& value: collection) {
+            addresses.push_back(&value);
+        }
+        std::stable_sort(addresses.begin(), addresses.end(), [](const int* lhs, const int* rhs) {
+            return *lhs < *rhs;
+        });
+
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+        CHECK( std::equal(collection.begin(), collection.end(), addresses.begin(),
+                          [](const int& value, const int* address) {
+                              return &value == address;
+                          }) );
+    }
+
+    SECTION( "values are not moved" )
+    {
+        int moves = 0;
+        std::list<move_counter> collection;
+        std::forward_list<move_counter> fcollection;
+        for (int value: vec) {
+            collection.emplace_back(value, moves);
+            fcollection.emplace_front(value, moves);
+        }
+
+        sorter(collection, &move_counter::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(),
+                              [](const auto& lhs, const auto& rhs) {
+                                  return lhs.value < rhs.value;
+                              }) );
+
+        sorter(fcollection, std::greater<>{}, &move_counter::value);
+        CHECK( std::is_sorted(fcollection.begin(), fcollection.end(),
+                              [](const auto& lhs, const auto& rhs) {
+                                  return lhs.value > rhs.value;
+                              }) );
+
+        CHECK( moves == 0 );
+    }
+
+    SECTION( "no element is lost when the comparison throws" )
+    {
+        std::list<double> collection(vec.begin(), vec.end());
+        std::forward_list<double> fcollection(vec.begin(), vec.end());
+
+        int remaining = 500;
+        CHECK_THROWS_AS( sorter(collection, throwing_less{&remaining}), std::runtime_error );
+        CHECK( collection.size() == vec.size() );
+        CHECK( std::is_permutation(collection.begin(), collection.end(), vec.begin()) );
+
+        remaining = 500;
+        CHECK_THROWS_AS( sorter(fcollection, throwing_less{&remaining}), std::runtime_error );
+        CHECK( std::distance(fcollection.begin(), fcollection.end()) == 1000 );
+        CHECK( std::is_permutation(fcollection.begin(), fcollection.end(), vec.begin()) );
+    }
+
+    SECTION( "empty lists" )
+    {
+        std::list<int> collection;
+        std::forward_list<int> fcollection;
+        sorter(collection);
+        sorter(fcollection);
+        CHECK( collection.empty() );
+        CHECK( fcollection.empty() );
+    }
+
+    SECTION( "return value forwarding" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::out_of_place_adapter<
+                cppsort::counting_adapter<cppsort::heap_sorter>
+            >
+        > counting_sorter;
+
+        std::forward_list<int> collection(vec.begin(), vec.end());
+        auto count = counting_sorter(collection);
+        CHECK( count > 0 );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/prefix_cache_adapter.h>
+#include <cpp-sort/sorters.h>
+#include <testing-tools/algorithm.h>
+
+namespace
+{
+    struct wrapper
+    {
+        std::string value;
+        int index;
+    };
+
+    auto make_wrappers(std::mt19937& engine, int size)
+        -> std::vector<wrapper>
+    {
+        // Strings around the size of the cached prefixes, with
+        // embedded null characters and negative chars
+        const char chars[] = { 'a', 'b', '\0', '\xff' };
+
+        std::vector<wrapper> res;
+        for (int i = 0 ; i < size ; ++i) {
+            std::string str(engine() % 10, 'p');
+            auto length = engine() % 6;
+            for (std::size_t j = 0 ; j < length ; ++j) {
+                str += chars[engine() % 4];
+            }
+            res.push_back({str, i});
+        }
+        return res;
+    }
+}
+
+TEMPLATE_TEST_CASE( "every random-access sorter with prefix_cache_adapter", "[prefix_cache_adapter]",
+                    cppsort::drop_merge_sorter,
+                    cppsort::heap_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::poplar_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::quick_sorter,
+                    cppsort::smooth_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::tim_sorter,
+                    cppsort::verge_sorter )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    auto collection = make_wrappers(engine, 1000);
+
+    cppsort::prefix_cache_adapter<TestType> sorter;
+
+    SECTION( "ascending order" )
+    {
+        sorter(collection, &wrapper::value);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &wrapper::value) );
+    }
+
+    SECTION( "descending order" )
+    {
+        sorter(collection, std::greater<>{}, &wrapper::value);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::greater<>{}, &wrapper::value) );
+    }
+}
+
+TEST_CASE( "prefix_cache_adapter tests", "[prefix_cache_adapter]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    SECTION( "stability" )
+    {
+        auto collection = make_wrappers(engine, 1000);
+        auto copy = collection;
+        std::stable_sort(copy.begin(), copy.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        });
+
+        cppsort::prefix_cache_adapter<cppsort::merge_sorter> sorter;
+        static_assert(cppsort::is_always_stable<decltype(sorter)>::value, "");
+        sorter(collection, &wrapper::value);
+        CHECK( std::equal(collection.begin(), collection.end(), copy.begin(),
+                          [](const auto& lhs, const auto& rhs) {
+                              return lhs.index == rhs.index;
+                          }) );
+    }
+
+    SECTION( "wide strings" )
+    {
+        std::vector<std::u32string> collection;
+        for (auto& elem: make_wrappers(engine, 1000)) {
+            collection.emplace_back(elem.value.begin(), elem.value.end());
+        }
+        auto copy = collection;
+        std::sort(copy.begin(), copy.end());
+
+        cppsort::prefix_cache_adapter<cppsort::pdq_sorter>{}(collection);
+        CHECK( collection == copy );
+    }
+
+    SECTION( "bidirectional iterators" )
+    {
+        std::list<std::string> collection;
+        for (auto& elem: make_wrappers(engine, 1000)) {
+            collection.push_back(elem.value);
+        }
+
+        cppsort::prefix_cache_adapter<cppsort::merge_sorter>{}(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "forward to the adapted sorter" )
+    {
+        // Neither strings nor a supported comparison
+        std::vector<int> collection(500);
+        std::iota(collection.begin(), collection.end(), 0);
+        std::shuffle(collection.begin(), collection.end(), engine);
+
+        cppsort::prefix_cache_adapter<cppsort::pdq_sorter> sorter;
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        auto strings = make_wrappers(engine, 500);
+        sorter(strings, [](const std::string& lhs, const std::string& rhs) {
+            return lhs.size() < rhs.size();
+        }, &wrapper::value);
+        CHECK( std::is_sorted(strings.begin(), strings.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value.size() < rhs.value.size();
+        }) );
+    }
+}
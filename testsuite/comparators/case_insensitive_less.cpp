@@ -2,13 +2,51 @@
  * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <locale>
+#include <random>
 #include <string>
+#include <vector>
 #include <catch2/catch.hpp>
+#include <cpp-sort/adapters/schwartz_adapter.h>
 #include <cpp-sort/comparators/case_insensitive_less.h>
 #include <cpp-sort/refined.h>
 #include <cpp-sort/sorters/heap_sorter.h>
+#include <cpp-sort/sorters/spread_sorter.h>
+
+namespace
+{
+    auto make_strings(std::mt19937& engine, int size)
+        -> std::vector<std::string>
+    {
+        // Long common prefixes to exercise the word-at-a-time path,
+        // with non-ASCII characters and characters around the letters
+        const char chars[] = { 'a', 'A', 'z', 'Z', '@', '[', '`', '{', '\xc9', '\xe9' };
+
+        std::vector<std::string> res;
+        for (int i = 0 ; i < size ; ++i) {
+            std::string str(engine() % 20, 'x');
+            auto length = engine() % 12;
+            for (std::size_t j = 0 ; j < length ; ++j) {
+                str += chars[engine() % 10];
+            }
+            res.push_back(str);
+        }
+        return res;
+    }
+
+    auto reference_less(const std::string& lhs, const std::string& rhs)
+        -> bool
+    {
+        auto& ct = std::use_facet<std::ctype<char>>(std::locale());
+        return std::lexicographical_compare(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            [&ct](char x, char y) { return ct.tolower(x) < ct.tolower(y); }
+        );
+    }
+}
 
 namespace sub
 {
@@ -95,3 +133,46 @@ TEST_CASE( "case-insensitive string comparison with case_insensitive_less" )
     }
 }
 
+
+TEST_CASE( "case_insensitive_less fast path and keys" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    auto strings = make_strings(engine, 300);
+
+    SECTION( "refined comparator on std::string" )
+    {
+        auto compare = cppsort::refined<std::string>(cppsort::case_insensitive_less);
+        auto compare_loc = compare(std::locale::classic());
+        for (std::size_t i = 1 ; i < strings.size() ; ++i) {
+            const auto& lhs = strings[i - 1];
+            const auto& rhs = strings[i];
+            CHECK( compare(lhs, rhs) == reference_less(lhs, rhs) );
+            CHECK( compare(rhs, lhs) == reference_less(rhs, lhs) );
+            CHECK( compare_loc(lhs, rhs) == reference_less(lhs, rhs) );
+        }
+    }
+
+    SECTION( "case-folded keys" )
+    {
+        for (std::size_t i = 1 ; i < strings.size() ; ++i) {
+            const auto& lhs = strings[i - 1];
+            const auto& rhs = strings[i];
+            CHECK( (cppsort::case_insensitive_key(lhs) < cppsort::case_insensitive_key(rhs))
+                   == reference_less(lhs, rhs) );
+        }
+
+        std::wstring wstr = L"HeLLo";
+        CHECK( cppsort::case_insensitive_key(std::locale::classic())(wstr) == L"hello" );
+    }
+
+    SECTION( "sort with case-folded keys" )
+    {
+        auto copy = strings;
+        std::stable_sort(copy.begin(), copy.end(), &reference_less);
+
+        cppsort::schwartz_adapter<cppsort::spread_sorter> sorter;
+        sorter(strings, cppsort::case_insensitive_key);
+        CHECK( std::is_sorted(strings.begin(), strings.end(), &reference_less) );
+        CHECK( std::is_permutation(strings.begin(), strings.end(), copy.begin()) );
+    }
+}
@@ -2,11 +2,18 @@
  * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <iterator>
+#include <random>
 #include <string>
+#include <vector>
 #include <catch2/catch.hpp>
+#include <cpp-sort/adapters/schwartz_adapter.h>
 #include <cpp-sort/comparators/natural_less.h>
 #include <cpp-sort/sorters/heap_sorter.h>
+#include <cpp-sort/sorters/spread_sorter.h>
 
 TEST_CASE( "string natural sort with natural_less" )
 {
@@ -33,3 +40,38 @@ TEST_CASE( "string natural sort with natural_less" )
     CHECK( array == expected );
 }
 
+
+TEST_CASE( "natural sort with natural_key", "[natural_key]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    // File-name-like strings with numbers of various lengths
+    // and leading zeros
+    const char chars[] = { 'a', 'b', ' ', '.', '0', '0', '1', '9', '\xe9' };
+    std::vector<std::string> vec;
+    for (int i = 0 ; i < 1000 ; ++i) {
+        std::string str;
+        auto size = engine() % 12;
+        for (std::size_t j = 0 ; j < size ; ++j) {
+            str += chars[engine() % sizeof(chars)];
+        }
+        vec.push_back(str);
+    }
+
+    SECTION( "keys order is consistent with natural_less" )
+    {
+        for (std::size_t i = 1 ; i < vec.size() ; ++i) {
+            const auto& lhs = vec[i - 1];
+            const auto& rhs = vec[i];
+            CHECK( cppsort::natural_less(lhs, rhs) == (cppsort::natural_key(lhs) < cppsort::natural_key(rhs)) );
+            CHECK( cppsort::natural_less(rhs, lhs) == (cppsort::natural_key(rhs) < cppsort::natural_key(lhs)) );
+        }
+    }
+
+    SECTION( "radix sort with schwartz_adapter" )
+    {
+        cppsort::schwartz_adapter<cppsort::string_spread_sorter> sorter;
+        sorter(vec, cppsort::natural_key);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), cppsort::natural_less) );
+    }
+}
@@ -2,11 +2,18 @@
  * Copyright (c) 2016-2020 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
+#include <random>
+#include <vector>
 #include <catch2/catch.hpp>
+#include <cpp-sort/comparators/total_greater.h>
 #include <cpp-sort/comparators/total_less.h>
 #include <cpp-sort/sorters/heap_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/sorters/spread_sorter.h>
 
 TEST_CASE( "IEEE 754 totalOrder implementation" )
 {
@@ -33,3 +40,58 @@ TEST_CASE( "IEEE 754 totalOrder implementation" )
     CHECK( std::isnan(array[7]) );
     CHECK( not std::signbit(array[7]) );
 }
+
+TEST_CASE( "IEEE 754 totalOrder with radix sorters" )
+{
+    static constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    static constexpr double inf = std::numeric_limits<double>::infinity();
+
+    // Pseudo-random number engine
+    std::mt19937_64 engine(Catch::rngSeed());
+
+    // Enough elements to go through the radix passes
+    std::vector<double> vec;
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+    for (int i = 0 ; i < 10'000 ; ++i) {
+        vec.push_back(dist(engine));
+    }
+    for (int i = 0 ; i < 500 ; ++i) {
+        vec.insert(vec.end(), { +nan, -nan, +inf, -inf, +0.0, -0.0 });
+    }
+
+    SECTION( "ska_sorter" )
+    {
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        cppsort::ska_sort(vec, cppsort::total_less);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), cppsort::total_less) );
+
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        cppsort::ska_sort(vec, cppsort::total_greater);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), cppsort::total_greater) );
+    }
+
+    SECTION( "spread_sorter" )
+    {
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        cppsort::spread_sort(vec, cppsort::total_less);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), cppsort::total_less) );
+
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        cppsort::spread_sort(vec, cppsort::total_greater);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), cppsort::total_greater) );
+    }
+
+    SECTION( "small collections" )
+    {
+        float array[] = { +1.0f, +float(inf), -1.0f, -float(nan), +0.0f, -float(inf), +float(nan), -0.0f };
+        cppsort::ska_sort(array, cppsort::total_less);
+        CHECK( std::is_sorted(std::begin(array), std::end(array), cppsort::total_less) );
+        CHECK( std::signbit(array[3]) );
+        CHECK( not std::signbit(array[4]) );
+
+        cppsort::spread_sort(array, cppsort::total_greater);
+        CHECK( std::is_sorted(std::begin(array), std::end(array), cppsort::total_greater) );
+        CHECK( not std::signbit(array[3]) );
+        CHECK( std::signbit(array[4]) );
+    }
+}
@@ -42,6 +42,7 @@ namespace
 
 TEMPLATE_TEST_CASE( "test every sorter with long std::string", "[sorters]",
                     cppsort::block_sorter<>,
+                    cppsort::burst_sorter,
                     cppsort::block_sorter<
                         cppsort::utility::dynamic_buffer<cppsort::utility::half>
                     >,
@@ -53,8 +54,10 @@ TEMPLATE_TEST_CASE( "test every sorter with long std::string", "[sorters]",
                     >,
                     cppsort::heap_sorter,
                     cppsort::insertion_sorter,
+                    cppsort::lcp_merge_sorter,
                     cppsort::merge_insertion_sorter,
                     cppsort::merge_sorter,
+                    cppsort::multikey_quick_sorter,
                     cppsort::pdq_sorter,
                     cppsort::poplar_sorter,
                     cppsort::quick_merge_sorter,
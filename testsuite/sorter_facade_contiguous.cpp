@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <array>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/functional.h>
+
+namespace
+{
+    enum struct call
+    {
+        iterator,
+        pointer
+    };
+
+    struct comparison_projection_sorter_impl
+    {
+        template<
+            typename Iterator,
+            typename Compare = std::less<>,
+            typename Projection = cppsort::utility::identity,
+            typename = std::enable_if_t<cppsort::is_projection_iterator_v<
+                Projection, Iterator, Compare
+            >>
+        >
+        auto operator()(Iterator, Iterator, Compare={}, Projection={}) const
+            -> call
+        {
+            return std::is_pointer<Iterator>::value ? call::pointer : call::iterator;
+        }
+    };
+
+    struct comparison_projection_sorter:
+        cppsort::sorter_facade<comparison_projection_sorter_impl>
+    {};
+
+    struct iterator_returning_sorter_impl
+    {
+        template<typename Iterator>
+        auto operator()(Iterator first, Iterator) const
+            -> Iterator
+        {
+            return first;
+        }
+    };
+
+    struct iterator_returning_sorter:
+        cppsort::sorter_facade<iterator_returning_sorter_impl>
+    {};
+}
+
+TEST_CASE( "sorter_facade unwraps contiguous iterators",
+           "[sorter_facade][contiguous]" )
+{
+    comparison_projection_sorter sorter;
+
+    SECTION( "contiguous iterators" )
+    {
+        std::vector<int> vec = { 3, 1, 2 };
+        CHECK( sorter(vec) == call::pointer );
+        CHECK( sorter(vec.begin(), vec.end()) == call::pointer );
+        CHECK( sorter(vec, std::greater<>{}) == call::pointer );
+        CHECK( sorter(vec, std::negate<>{}) == call::pointer );
+        CHECK( sorter(vec.begin(), vec.end(), std::greater<>{}, std::negate<>{}) == call::pointer );
+
+        std::array<int, 3> arr = {{ 3, 1, 2 }};
+        CHECK( sorter(arr) == call::pointer );
+
+        std::string str = "cab";
+        CHECK( sorter(str) == call::pointer );
+
+        int c_arr[] = { 3, 1, 2 };
+        CHECK( sorter(c_arr) == call::pointer );
+    }
+
+    SECTION( "empty ranges" )
+    {
+        std::vector<int> vec;
+        CHECK( sorter(vec) == call::iterator );
+    }
+
+    SECTION( "non-contiguous iterators" )
+    {
+        std::deque<int> deq = { 3, 1, 2 };
+        CHECK( sorter(deq) == call::iterator );
+
+        std::vector<bool> bits = { true, false, true };
+        CHECK( sorter(bits) == call::iterator );
+
+        std::vector<int> vec = { 3, 1, 2 };
+        CHECK( sorter(vec.rbegin(), vec.rend()) == call::iterator );
+    }
+
+    SECTION( "return type depending on the iterator type" )
+    {
+        std::vector<int> vec = { 3, 1, 2 };
+        auto it = iterator_returning_sorter{}(vec);
+        static_assert(std::is_same<decltype(it), std::vector<int>::iterator>::value, "");
+        CHECK( it == vec.begin() );
+    }
+
+    SECTION( "sorting through unwrapped iterators" )
+    {
+        std::vector<int> vec = { 5, 8, 1, 3, 9, 2, 7 };
+        cppsort::pdq_sort(vec.begin(), vec.end());
+        CHECK( vec == std::vector<int>({ 1, 2, 3, 5, 7, 8, 9 }) );
+    }
+}
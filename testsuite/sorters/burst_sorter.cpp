@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/burst_sorter.h>
+#include <testing-tools/strings.h>
+
+TEST_CASE( "burst_sorter tests", "[burst_sorter]" )
+{
+    // Pseudo-random number engine
+    std::mt19937_64 engine(Catch::rngSeed());
+
+    // The collections are big enough for buckets to burst
+
+    SECTION( "sort with std::string" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 50'000);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy));
+
+        cppsort::burst_sort(vec);
+        CHECK( vec == copy );
+    }
+
+    SECTION( "reverse sort with std::string" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 50'000);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy), std::greater<>{});
+
+        cppsort::burst_sort(std::begin(vec), std::end(vec), std::greater<>{});
+        CHECK( vec == copy );
+    }
+
+    SECTION( "sort with other character types" )
+    {
+        auto vec16 = helpers::make_strings<std::u16string>(engine, 50'000);
+        auto copy16 = vec16;
+        std::sort(std::begin(copy16), std::end(copy16));
+        cppsort::burst_sort(vec16);
+        CHECK( vec16 == copy16 );
+
+        auto vec32 = helpers::make_strings<std::u32string>(engine, 50'000);
+        auto copy32 = vec32;
+        std::sort(std::begin(copy32), std::end(copy32), std::greater<>{});
+        cppsort::burst_sort(vec32, std::greater<>{});
+        CHECK( vec32 == copy32 );
+    }
+
+    SECTION( "sort with many equal strings" )
+    {
+        std::vector<std::string> vec(30'000, "all equal");
+        auto other = helpers::make_strings<std::string>(engine, 20'000);
+        vec.insert(std::end(vec), std::begin(other), std::end(other));
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy));
+
+        cppsort::burst_sort(vec);
+        CHECK( vec == copy );
+    }
+
+    SECTION( "sort with many identical long strings" )
+    {
+        std::vector<std::string> vec(10'000, std::string(5'000, 'y'));
+        cppsort::burst_sort(vec);
+        CHECK( vec.size() == 10'000 );
+        CHECK( std::all_of(std::begin(vec), std::end(vec), [](const std::string& str) {
+            return str == std::string(5'000, 'y');
+        }) );
+    }
+
+    SECTION( "sort with strings sharing a long prefix" )
+    {
+        const std::string prefix(1'000, 'x');
+        std::vector<std::string> vec;
+        for (auto& str: helpers::make_strings<std::string>(engine, 30'000)) {
+            vec.push_back(prefix + str);
+        }
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy));
+
+        cppsort::burst_sort(vec);
+        CHECK( vec == copy );
+    }
+
+    SECTION( "sort with projection" )
+    {
+        struct wrapper { std::string value; };
+
+        std::vector<wrapper> vec;
+        for (auto& str: helpers::make_strings<std::string>(engine, 50'000)) {
+            vec.push_back({str});
+        }
+        cppsort::burst_sort(vec, &wrapper::value);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        }) );
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/lcp_merge_sorter.h>
+#include <testing-tools/strings.h>
+
+namespace
+{
+    struct wrapper
+    {
+        std::string value;
+        int index;
+    };
+
+    auto make_wrappers(std::mt19937_64& engine, int size)
+        -> std::vector<wrapper>
+    {
+        std::vector<wrapper> res;
+        int index = 0;
+        for (auto& str: helpers::make_strings<std::string>(engine, size, 8)) {
+            res.push_back({str, index++});
+        }
+        return res;
+    }
+}
+
+TEST_CASE( "lcp_merge_sorter tests", "[lcp_merge_sorter]" )
+{
+    // Pseudo-random number engine
+    std::mt19937_64 engine(Catch::rngSeed());
+
+    SECTION( "sort with std::string" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 10'000, 8);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy));
+
+        cppsort::lcp_merge_sort(vec);
+        CHECK( vec == copy );
+    }
+
+    SECTION( "sort with other character types" )
+    {
+        auto vec16 = helpers::make_strings<std::u16string>(engine, 10'000, 8);
+        auto copy16 = vec16;
+        std::sort(std::begin(copy16), std::end(copy16));
+        cppsort::lcp_merge_sort(vec16);
+        CHECK( vec16 == copy16 );
+
+        auto wvec = helpers::make_strings<std::wstring>(engine, 10'000, 8);
+        auto wcopy = wvec;
+        std::sort(std::begin(wcopy), std::end(wcopy));
+        cppsort::lcp_merge_sort(wvec);
+        CHECK( wvec == wcopy );
+    }
+
+    SECTION( "stability" )
+    {
+        auto vec = make_wrappers(engine, 10'000);
+        auto copy = vec;
+        std::stable_sort(std::begin(copy), std::end(copy), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        });
+
+        cppsort::lcp_merge_sort(vec, &wrapper::value);
+        CHECK( std::equal(std::begin(vec), std::end(vec), std::begin(copy),
+                          [](const auto& lhs, const auto& rhs) {
+                              return lhs.index == rhs.index;
+                          }) );
+    }
+
+    SECTION( "stability with std::greater<>" )
+    {
+        auto vec = make_wrappers(engine, 10'000);
+        auto copy = vec;
+        std::stable_sort(std::begin(copy), std::end(copy), [](const auto& lhs, const auto& rhs) {
+            return lhs.value > rhs.value;
+        });
+
+        cppsort::lcp_merge_sort(vec, std::greater<>{}, &wrapper::value);
+        CHECK( std::equal(std::begin(vec), std::end(vec), std::begin(copy),
+                          [](const auto& lhs, const auto& rhs) {
+                              return lhs.index == rhs.index;
+                          }) );
+    }
+
+    SECTION( "LCP array" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 10'000, 8);
+        std::vector<std::size_t> lcp;
+
+        cppsort::lcp_merge_sort.sort_with_lcp(vec, std::back_inserter(lcp));
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+        REQUIRE( lcp.size() == vec.size() );
+
+        CHECK( lcp[0] == 0 );
+        for (std::size_t i = 1 ; i < vec.size() ; ++i) {
+            auto mismatch = std::mismatch(
+                std::begin(vec[i - 1]), std::begin(vec[i - 1]) + std::min(vec[i - 1].size(), vec[i].size()),
+                std::begin(vec[i])
+            );
+            auto expected = static_cast<std::size_t>(mismatch.first - std::begin(vec[i - 1]));
+            CHECK( lcp[i] == expected );
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/multikey_quick_sorter.h>
+#include <testing-tools/strings.h>
+
+TEST_CASE( "multikey_quick_sorter tests", "[multikey_quick_sorter]" )
+{
+    // Pseudo-random number engine
+    std::mt19937_64 engine(Catch::rngSeed());
+
+    SECTION( "sort with std::string" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 10'000);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy));
+
+        cppsort::multikey_quick_sort(vec);
+        CHECK( vec == copy );
+    }
+
+    SECTION( "reverse sort with std::string" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 10'000);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy), std::greater<>{});
+
+        cppsort::multikey_quick_sort(std::begin(vec), std::end(vec), std::greater<>{});
+        CHECK( vec == copy );
+    }
+
+    SECTION( "sort with other character types" )
+    {
+        auto vec16 = helpers::make_strings<std::u16string>(engine, 10'000);
+        auto copy16 = vec16;
+        std::sort(std::begin(copy16), std::end(copy16));
+        cppsort::multikey_quick_sort(vec16);
+        CHECK( vec16 == copy16 );
+
+        auto vec32 = helpers::make_strings<std::u32string>(engine, 10'000);
+        auto copy32 = vec32;
+        std::sort(std::begin(copy32), std::end(copy32));
+        cppsort::multikey_quick_sort(vec32);
+        CHECK( vec32 == copy32 );
+
+        auto wvec = helpers::make_strings<std::wstring>(engine, 10'000);
+        auto wcopy = wvec;
+        std::sort(std::begin(wcopy), std::end(wcopy));
+        cppsort::multikey_quick_sort(wvec);
+        CHECK( wvec == wcopy );
+    }
+
+    SECTION( "sort with many equal strings" )
+    {
+        std::vector<std::string> vec(5'000, "all equal");
+        auto other = helpers::make_strings<std::string>(engine, 5'000);
+        vec.insert(std::end(vec), std::begin(other), std::end(other));
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        auto copy = vec;
+        std::sort(std::begin(copy), std::end(copy));
+
+        cppsort::multikey_quick_sort(vec);
+        CHECK( vec == copy );
+    }
+
+    SECTION( "sort with projection" )
+    {
+        struct wrapper { std::string value; };
+
+        std::vector<wrapper> vec;
+        for (auto& str: helpers::make_strings<std::string>(engine, 10'000)) {
+            vec.push_back({str});
+        }
+        cppsort::multikey_quick_sort(vec, &wrapper::value);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        }) );
+    }
+
+    SECTION( "LCP array" )
+    {
+        auto vec = helpers::make_strings<std::string>(engine, 10'000);
+        std::vector<std::size_t> lcp(vec.size(), 42);
+
+        auto it = cppsort::multikey_quick_sort.sort_with_lcp(vec, std::begin(lcp));
+        CHECK( it == std::end(lcp) );
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+
+        CHECK( lcp[0] == 0 );
+        for (std::size_t i = 1 ; i < vec.size() ; ++i) {
+            auto mismatch = std::mismatch(
+                std::begin(vec[i - 1]), std::begin(vec[i - 1]) + std::min(vec[i - 1].size(), vec[i].size()),
+                std::begin(vec[i])
+            );
+            auto expected = static_cast<std::size_t>(mismatch.first - std::begin(vec[i - 1]));
+            CHECK( lcp[i] == expected );
+        }
+    }
+}
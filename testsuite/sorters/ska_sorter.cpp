@@ -39,6 +39,15 @@ TEST_CASE( "ska_sorter tests", "[ska_sorter]" )
         cppsort::ska_sort(vec);
         CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
     }
+
+    SECTION( "sort with signed int128 iterable" )
+    {
+        std::vector<__int128_t> vec(100'000);
+        std::iota(std::begin(vec), std::end(vec), -(__int128_t(1) << 100));
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        cppsort::ska_sort(vec);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
 #endif
 
     SECTION( "sort with unsigned int iterators" )
@@ -3,10 +3,12 @@
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <numeric>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 #include <catch2/catch.hpp>
 #include <cpp-sort/sorters/spread_sorter.h>
@@ -34,6 +36,48 @@ TEST_CASE( "spread_sorter tests", "[spread_sorter]" )
         CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
     }
 
+#ifdef __SIZEOF_INT128__
+    SECTION( "sort with signed int128 iterable" )
+    {
+        std::vector<__int128_t> vec(100'000);
+        std::iota(std::begin(vec), std::end(vec), -(__int128_t(1) << 100));
+        std::shuffle(std::begin(vec), std::end(vec), engine);
+        cppsort::spread_sort(vec);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
+
+    SECTION( "sort with unsigned int128 iterators" )
+    {
+        std::vector<__uint128_t> vec;
+        for (int i = 0 ; i < 100'000 ; ++i) {
+            vec.push_back((__uint128_t(engine()) << 64) | engine());
+        }
+        cppsort::spread_sort(std::begin(vec), std::end(vec));
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
+
+    SECTION( "sort with pairs of 64-bit integers" )
+    {
+        std::vector<std::pair<std::uint64_t, std::int64_t>> vec;
+        for (int i = 0 ; i < 100'000 ; ++i) {
+            vec.emplace_back(engine() % 100, static_cast<std::int64_t>(engine()));
+        }
+        cppsort::spread_sort(vec);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
+#endif
+
+    SECTION( "sort with pairs of small integers" )
+    {
+        std::vector<std::pair<short, int>> vec;
+        for (int i = 0 ; i < 100'000 ; ++i) {
+            vec.emplace_back(static_cast<short>(engine() % 50 - 25),
+                             static_cast<int>(engine()));
+        }
+        cppsort::spread_sort(vec);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
+
     SECTION( "sort with float iterable" )
     {
         std::vector<float> vec(100'000);
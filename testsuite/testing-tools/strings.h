@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_TESTSUITE_STRINGS_H_
+#define CPPSORT_TESTSUITE_STRINGS_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace helpers
+{
+    ////////////////////////////////////////////////////////////
+    // Generate strings meant to stress string sorters: long
+    // shared prefixes, embedded null characters and characters
+    // whose signedness matters, followed by up to max_suffix - 1
+    // random characters
+
+    template<typename String>
+    auto make_strings(std::mt19937_64& engine, int size, std::size_t max_suffix=12)
+        -> std::vector<String>
+    {
+        using char_type = typename String::value_type;
+
+        const String prefixes[] = {
+            String(40, char_type('p')),
+            String(3, char_type('p')),
+            String(),
+        };
+        const char_type chars[] = {
+            char_type('a'), char_type('b'), char_type(0), char_type(-1)
+        };
+
+        std::vector<String> res;
+        for (int i = 0 ; i < size ; ++i) {
+            String str = prefixes[engine() % 3];
+            auto length = engine() % max_suffix;
+            for (std::size_t j = 0 ; j < length ; ++j) {
+                str += chars[engine() % 4];
+            }
+            res.push_back(str);
+        }
+        return res;
+    }
+}
+
+#endif // CPPSORT_TESTSUITE_STRINGS_H_
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/apply_permutation.h>
+#include <cpp-sort/utility/sort_permutation.h>
+
+TEST_CASE( "apply_permutation tests", "[utility][apply_permutation]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    std::vector<int> keys(1000);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), engine);
+
+    std::vector<std::string> names;
+    for (int key: keys) {
+        names.push_back(std::to_string(key));
+    }
+
+    auto permutation = cppsort::utility::sort_permutation(cppsort::pdq_sort, keys);
+
+    SECTION( "in place, several collections" )
+    {
+        cppsort::utility::apply_permutation(permutation, keys, names);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        for (std::size_t i = 0 ; i < keys.size() ; ++i) {
+            CHECK( names[i] == std::to_string(keys[i]) );
+        }
+    }
+
+    SECTION( "in place, move-only types" )
+    {
+        std::vector<std::unique_ptr<int>> collection;
+        for (int key: keys) {
+            collection.push_back(std::make_unique<int>(key));
+        }
+        cppsort::utility::apply_permutation(permutation, collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end(),
+                              [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; }) );
+    }
+
+    SECTION( "out of place" )
+    {
+        std::vector<int> sorted_keys;
+        cppsort::utility::apply_permutation_copy(permutation, keys.begin(),
+                                                 std::back_inserter(sorted_keys));
+        CHECK( std::is_sorted(sorted_keys.begin(), sorted_keys.end()) );
+
+        std::vector<std::string> sorted_names(names.size());
+        auto res = cppsort::utility::apply_permutation_copy(permutation,
+                                                            std::make_move_iterator(names.begin()),
+                                                            sorted_names.begin());
+        CHECK( res == sorted_names.end() );
+        for (std::size_t i = 0 ; i < sorted_keys.size() ; ++i) {
+            CHECK( sorted_names[i] == std::to_string(sorted_keys[i]) );
+        }
+    }
+
+    SECTION( "out of place, several collections" )
+    {
+        std::vector<int> sorted_keys(keys.size());
+        std::vector<std::string> sorted_names;
+        auto res = cppsort::utility::apply_permutation_copy(permutation,
+                                                            keys.begin(), sorted_keys.begin(),
+                                                            names.begin(), std::back_inserter(sorted_names));
+        CHECK( std::get<0>(res) == sorted_keys.end() );
+        CHECK( std::is_sorted(sorted_keys.begin(), sorted_keys.end()) );
+        REQUIRE( sorted_names.size() == names.size() );
+        for (std::size_t i = 0 ; i < sorted_keys.size() ; ++i) {
+            CHECK( sorted_names[i] == std::to_string(sorted_keys[i]) );
+        }
+    }
+
+    SECTION( "identity and empty permutations" )
+    {
+        std::vector<std::uint32_t> identity(keys.size());
+        std::iota(identity.begin(), identity.end(), 0);
+        auto copy = keys;
+        cppsort::utility::apply_permutation(identity, keys);
+        CHECK( keys == copy );
+
+        std::vector<std::uint32_t> empty;
+        std::vector<int> empty_keys;
+        cppsort::utility::apply_permutation(empty, empty_keys);
+        CHECK( empty_keys.empty() );
+    }
+}
+
+TEST_CASE( "apply_permutation_copy with big permutations",
+           "[utility][apply_permutation]" )
+{
+    // Big enough to be split in blocks gathered in parallel
+    std::mt19937 engine(Catch::rngSeed());
+    std::vector<std::uint32_t> permutation(300000);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), engine);
+
+    std::vector<long long> collection(permutation.size());
+    std::iota(collection.begin(), collection.end(), 0);
+
+    SECTION( "random-access output" )
+    {
+        std::vector<long long> res(collection.size());
+        auto last = cppsort::utility::apply_permutation_copy(permutation, collection.begin(), res.begin());
+        CHECK( last == res.end() );
+        CHECK( std::equal(res.begin(), res.end(), permutation.begin()) );
+    }
+
+    SECTION( "output iterator" )
+    {
+        std::vector<long long> res;
+        cppsort::utility::apply_permutation_copy(permutation, collection.begin(), std::back_inserter(res));
+        CHECK( std::equal(res.begin(), res.end(), permutation.begin(), permutation.end()) );
+    }
+}
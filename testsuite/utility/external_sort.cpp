@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/external_sort.h>
+#include <cpp-sort/utility/functional.h>
+
+namespace
+{
+    struct record
+    {
+        std::uint32_t key;
+        std::uint32_t position;
+    };
+
+    auto write_file(const std::string& path, const std::vector<record>& records)
+        -> void
+    {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        REQUIRE( file != nullptr );
+        if (not records.empty()) {
+            std::fwrite(records.data(), sizeof(record), records.size(), file);
+        }
+        std::fclose(file);
+    }
+
+    auto read_file(const std::string& path)
+        -> std::vector<record>
+    {
+        std::vector<record> records;
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        REQUIRE( file != nullptr );
+        record rec;
+        while (std::fread(&rec, sizeof(record), 1, file) == 1) {
+            records.push_back(rec);
+        }
+        std::fclose(file);
+        return records;
+    }
+
+    auto make_records(std::size_t size, std::uint32_t max_key)
+        -> std::vector<record>
+    {
+        thread_local std::mt19937_64 engine(Catch::rngSeed());
+        std::uniform_int_distribution<std::uint32_t> dist(0, max_key);
+        std::vector<record> records;
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            records.push_back({ dist(engine), static_cast<std::uint32_t>(i) });
+        }
+        return records;
+    }
+
+    auto is_stably_sorted(const std::vector<record>& records)
+        -> bool
+    {
+        return std::is_sorted(records.begin(), records.end(), [](const record& lhs, const record& rhs) {
+            return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.position < rhs.position);
+        });
+    }
+}
+
+TEST_CASE( "external_sort tests", "[utility][external_sort]" )
+{
+    const std::string input = "cppsort-external-sort-input.bin";
+    const std::string output = "cppsort-external-sort-output.bin";
+
+    cppsort::utility::external_sort_options options;
+
+    SECTION( "input fitting in memory" )
+    {
+        auto records = make_records(1000, 100);
+        write_file(input, records);
+
+        auto count = cppsort::utility::external_sort<record>(
+            cppsort::merge_sort, input, output, options,
+            std::less<>{}, &record::key
+        );
+        CHECK( count == records.size() );
+        CHECK( is_stably_sorted(read_file(output)) );
+    }
+
+    SECTION( "many runs and merge passes" )
+    {
+        auto records = make_records(10000, 300);
+        write_file(input, records);
+
+        options.memory_limit = 100 * sizeof(record);
+        options.block_size = 4 * sizeof(record);
+        options.merge_order = 4;
+        options.temporary_directory = ".";
+
+        auto count = cppsort::utility::external_sort<record>(
+            cppsort::merge_sort, input, output, options, &record::key
+        );
+        CHECK( count == records.size() );
+        CHECK( is_stably_sorted(read_file(output)) );
+    }
+
+    SECTION( "unstable sorter and custom comparison" )
+    {
+        auto records = make_records(5000, 1000000);
+        write_file(input, records);
+
+        options.memory_limit = 512 * sizeof(record);
+
+        cppsort::utility::external_sort<record>(
+            cppsort::pdq_sort, input, output, options,
+            std::greater<>{}, &record::key
+        );
+        auto res = read_file(output);
+        CHECK( res.size() == records.size() );
+        CHECK( std::is_sorted(res.begin(), res.end(), [](const record& lhs, const record& rhs) {
+            return lhs.key > rhs.key;
+        }) );
+    }
+
+    SECTION( "sort a file in place" )
+    {
+        auto records = make_records(3000, 50);
+        write_file(input, records);
+
+        options.memory_limit = 1000 * sizeof(record);
+        cppsort::utility::external_sort<record>(
+            cppsort::merge_sort, input, input, options, &record::key
+        );
+        CHECK( is_stably_sorted(read_file(input)) );
+    }
+
+    SECTION( "empty input" )
+    {
+        write_file(input, {});
+        auto count = cppsort::utility::external_sort<record>(
+            cppsort::pdq_sort, input, output, options, &record::key
+        );
+        CHECK( count == 0 );
+        CHECK( read_file(output).empty() );
+    }
+
+    SECTION( "truncated record" )
+    {
+        std::FILE* file = std::fopen(input.c_str(), "wb");
+        REQUIRE( file != nullptr );
+        const char bytes[11] = {};
+        std::fwrite(bytes, 1, sizeof(bytes), file);
+        std::fclose(file);
+
+        CHECK_THROWS( cppsort::utility::external_sort<record>(
+            cppsort::pdq_sort, input, output, options, &record::key
+        ) );
+    }
+
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/kway_merge.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        int run;
+    };
+}
+
+TEST_CASE( "kway_merge tests", "[utility][kway_merge]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    SECTION( "merge runs of different sizes" )
+    {
+        std::vector<std::vector<int>> runs;
+        std::vector<int> expected;
+        for (int i = 0 ; i < 13 ; ++i) {
+            std::vector<int> run(engine() % 50);
+            for (auto& value: run) {
+                value = engine() % 100;
+            }
+            std::sort(run.begin(), run.end());
+            expected.insert(expected.end(), run.begin(), run.end());
+            runs.push_back(std::move(run));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> res;
+        cppsort::utility::kway_merge(runs, std::back_inserter(res));
+        CHECK( res == expected );
+    }
+
+    SECTION( "stability, projection and non-random-access runs" )
+    {
+        std::vector<std::list<wrapper>> runs(7);
+        for (int run = 0 ; run < 7 ; ++run) {
+            for (int value = 20 ; value > 0 ; value -= static_cast<int>(engine() % 3) + 1) {
+                runs[run].push_back({ value, run });
+            }
+        }
+
+        std::vector<wrapper> res;
+        cppsort::utility::kway_merge(runs, std::back_inserter(res),
+                                     std::greater<>{}, &wrapper::value);
+        CHECK( std::is_sorted(res.begin(), res.end(), [](const wrapper& lhs, const wrapper& rhs) {
+            return lhs.value > rhs.value || (lhs.value == rhs.value && lhs.run < rhs.run);
+        }) );
+    }
+
+    SECTION( "empty runs" )
+    {
+        std::vector<std::vector<int>> runs = { {}, { 1, 4 }, {}, {}, { 2, 3 }, {} };
+        std::vector<int> res;
+        cppsort::utility::kway_merge(runs, std::back_inserter(res));
+        CHECK( res == (std::vector<int>{ 1, 2, 3, 4 }) );
+
+        std::vector<std::vector<int>> no_runs;
+        cppsort::utility::kway_merge(no_runs, std::back_inserter(res));
+        CHECK( res.size() == 4 );
+    }
+}
+
+TEST_CASE( "kway_inplace_merge tests", "[utility][kway_merge]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    SECTION( "merge consecutive runs" )
+    {
+        std::vector<std::string> collection;
+        std::vector<std::vector<std::string>::iterator> ends;
+        std::vector<std::size_t> sizes;
+        for (int i = 0 ; i < 9 ; ++i) {
+            std::size_t size = engine() % 40;
+            std::vector<std::string> run;
+            for (std::size_t j = 0 ; j < size ; ++j) {
+                run.push_back(std::to_string(engine() % 1000));
+            }
+            std::sort(run.begin(), run.end());
+            collection.insert(collection.end(), run.begin(), run.end());
+            sizes.push_back(collection.size());
+        }
+        for (auto size: sizes) {
+            ends.push_back(collection.begin() + size);
+        }
+        auto expected = collection;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::utility::kway_inplace_merge(collection.begin(), ends);
+        CHECK( collection == expected );
+    }
+
+    SECTION( "move-only elements and projection" )
+    {
+        std::vector<std::unique_ptr<int>> collection;
+        std::vector<decltype(collection)::iterator> ends;
+        std::vector<std::size_t> sizes;
+        for (int run = 0 ; run < 5 ; ++run) {
+            for (int value = 0 ; value < 30 ; value += static_cast<int>(engine() % 4) + 1) {
+                collection.push_back(std::make_unique<int>(value));
+            }
+            sizes.push_back(collection.size());
+        }
+        for (auto size: sizes) {
+            ends.push_back(collection.begin() + size);
+        }
+
+        cppsort::utility::kway_inplace_merge(collection.begin(), ends,
+                                             [](const std::unique_ptr<int>& ptr) { return *ptr; });
+        CHECK( std::is_sorted(collection.begin(), collection.end(),
+                              [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; }) );
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/lazy_sorted_view.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        std::string name;
+    };
+}
+
+TEST_CASE( "lazy_sorted_view tests", "[utility][lazy_sorted_view]" )
+{
+    SECTION( "read the smallest elements only" )
+    {
+        std::vector<int> collection;
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), 10000, -5000);
+        auto expected = collection;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::utility::lazy_sorted_view<std::vector<int>::iterator> view(
+            collection.begin(), collection.end()
+        );
+        CHECK( view.size() == 10000 );
+        std::vector<int> smallest;
+        for (auto it = view.begin() ; smallest.size() < 100 ; ++it) {
+            smallest.push_back(*it);
+        }
+        CHECK( std::equal(smallest.begin(), smallest.end(), expected.begin()) );
+        CHECK( view.sorted_size() >= 100 );
+        CHECK( view.sorted_size() < 10000 );
+        CHECK( std::is_permutation(collection.begin(), collection.end(), expected.begin()) );
+
+        // Random access past the sorted prefix
+        CHECK( view[5000] == expected[5000] );
+        CHECK( std::equal(collection.begin(), collection.begin() + 5001, expected.begin()) );
+    }
+
+    SECTION( "read everything" )
+    {
+        auto check_distribution = [](auto distribution) {
+            std::vector<int> collection;
+            distribution(std::back_inserter(collection), 5000);
+            auto expected = collection;
+            std::sort(expected.begin(), expected.end());
+
+            cppsort::utility::lazy_sorted_view<std::vector<int>::iterator> view(
+                collection.begin(), collection.end()
+            );
+            std::vector<int> all(view.begin(), view.end());
+            CHECK( all == expected );
+            CHECK( collection == expected );
+        };
+        check_distribution(dist::shuffled{});
+        check_distribution(dist::shuffled_16_values{});
+        check_distribution(dist::all_equal{});
+        check_distribution(dist::ascending{});
+        check_distribution(dist::descending{});
+        check_distribution(dist::pipe_organ{});
+        check_distribution(dist::push_front{});
+        check_distribution(dist::alternating{});
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        std::vector<int> values;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(values), 1000);
+        std::vector<wrapper> collection;
+        for (int value: values) {
+            collection.push_back({ value, std::to_string(value) });
+        }
+
+        cppsort::utility::lazy_sorted_view<
+            std::vector<wrapper>::iterator, std::greater<>, int wrapper::*
+        > view(collection.begin(), collection.end(), {}, &wrapper::value);
+        CHECK( view.begin()->value == *std::max_element(values.begin(), values.end()) );
+        view.sort_prefix(view.size());
+        CHECK( std::is_sorted(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value > rhs.value;
+        }) );
+    }
+
+    SECTION( "empty collection" )
+    {
+        std::vector<int> collection;
+        cppsort::utility::lazy_sorted_view<std::vector<int>::iterator> view(
+            collection.begin(), collection.end()
+        );
+        CHECK( view.begin() == view.end() );
+        view.sort_prefix(10);
+        CHECK( view.sorted_size() == 0 );
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/mapped_file.h>
+#include <cpp-sort/utility/record_iterator.h>
+
+TEST_CASE( "sort a memory-mapped file", "[utility][mapped_file]" )
+{
+    const std::string path = "cppsort-mapped-file.bin";
+
+    std::mt19937 engine(Catch::rngSeed());
+    std::vector<std::uint64_t> values(1000);
+    for (auto& value: values) {
+        value = engine();
+    }
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    REQUIRE( file != nullptr );
+    std::fwrite(values.data(), sizeof(std::uint64_t), values.size(), file);
+    std::fclose(file);
+
+    {
+        cppsort::utility::mapped_file mapping(path);
+        CHECK( mapping.size() == values.size() * sizeof(std::uint64_t) );
+        mapping.advise(cppsort::utility::access_advice::will_need);
+
+        // Sort records of two values on the second one
+        auto range = cppsort::utility::records(mapping.data(), mapping.size(),
+                                               2 * sizeof(std::uint64_t));
+        cppsort::pdq_sort(range, cppsort::utility::record_field<std::uint64_t>(sizeof(std::uint64_t)));
+        mapping.sync();
+    }
+
+    std::vector<std::uint64_t> res(values.size());
+    file = std::fopen(path.c_str(), "rb");
+    REQUIRE( file != nullptr );
+    CHECK( std::fread(res.data(), sizeof(std::uint64_t), res.size(), file) == res.size() );
+    std::fclose(file);
+    std::remove(path.c_str());
+
+    for (std::size_t i = 3 ; i < res.size() ; i += 2) {
+        CHECK( res[i - 2] <= res[i] );
+    }
+    std::sort(values.begin(), values.end());
+    std::sort(res.begin(), res.end());
+    CHECK( res == values );
+}
+
+TEST_CASE( "map an empty file", "[utility][mapped_file]" )
+{
+    const std::string path = "cppsort-mapped-file-empty.bin";
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    REQUIRE( file != nullptr );
+    std::fclose(file);
+
+    {
+        cppsort::utility::mapped_file mapping(path);
+        CHECK( mapping.size() == 0 );
+        CHECK( mapping.data() == nullptr );
+        mapping.advise(cppsort::utility::access_advice::sequential);
+        mapping.sync();
+    }
+    std::remove(path.c_str());
+
+    CHECK_THROWS_AS( cppsort::utility::mapped_file(path), std::system_error );
+}
+
+#endif
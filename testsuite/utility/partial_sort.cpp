@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/nth_element.h>
+#include <cpp-sort/utility/partial_sort.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        std::string name;
+    };
+
+    template<typename Collection>
+    auto is_partially_sorted(const Collection& collection, const Collection& sorted,
+                             std::ptrdiff_t k)
+        -> bool
+    {
+        // The first k elements are the k smallest ones, in order, and
+        // the other elements are still there
+        if (not std::equal(collection.begin(), collection.begin() + k, sorted.begin())) {
+            return false;
+        }
+        return std::is_permutation(collection.begin(), collection.end(), sorted.begin());
+    }
+
+    // McIlroy's adversary: the values are decided while the
+    // algorithm runs so that the chosen pivots are as bad as
+    // possible, then frozen to replay the worst case
+    struct adversary_state
+    {
+        std::vector<int> values;
+        int gas;
+        int nb_solid = 0;
+        int candidate = 0;
+    };
+
+    struct adversary_less
+    {
+        adversary_state* state;
+
+        auto operator()(int lhs, int rhs) const
+            -> bool
+        {
+            auto& values = state->values;
+            if (values[lhs] == state->gas && values[rhs] == state->gas) {
+                values[lhs == state->candidate ? lhs : rhs] = state->nb_solid++;
+            }
+            if (values[lhs] == state->gas) {
+                state->candidate = lhs;
+            } else if (values[rhs] == state->gas) {
+                state->candidate = rhs;
+            }
+            return values[lhs] < values[rhs];
+        }
+    };
+}
+
+TEST_CASE( "partial_sort tests", "[utility][partial_sort]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    SECTION( "heap, selection and full sort paths" )
+    {
+        std::vector<int> collection(10000);
+        std::iota(collection.begin(), collection.end(), -5000);
+        std::shuffle(collection.begin(), collection.end(), engine);
+        auto sorted = collection;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (std::ptrdiff_t k: { 0, 1, 2, 50, 156, 157, 1000, 9999, 10000, 15000 }) {
+            auto vec = collection;
+            auto it = cppsort::utility::partial_sort(vec, k);
+            CHECK( it - vec.begin() == (std::min)(k, std::ptrdiff_t(10000)) );
+            CHECK( is_partially_sorted(vec, sorted, it - vec.begin()) );
+        }
+    }
+
+    SECTION( "patterns that defeat the heap path" )
+    {
+        std::vector<int> collection(10000);
+        std::iota(collection.begin(), collection.end(), 0);
+        auto sorted = collection;
+        std::reverse(collection.begin(), collection.end());
+
+        for (std::ptrdiff_t k: { 1, 10, 100 }) {
+            auto vec = collection;
+            cppsort::utility::partial_sort(vec.begin(), vec.end(), k);
+            CHECK( is_partially_sorted(vec, sorted, k) );
+        }
+    }
+
+    SECTION( "adversarial input for quickselect" )
+    {
+        const int size = 5000;
+        adversary_state state;
+        state.values.assign(size, size);
+        state.gas = size;
+        std::vector<int> indices(size);
+        std::iota(indices.begin(), indices.end(), 0);
+        cppsort::utility::nth_element(indices, size / 2, adversary_less{&state});
+
+        std::vector<int> collection = state.values;
+        auto sorted = collection;
+        std::sort(sorted.begin(), sorted.end());
+
+        long long nb_comparisons = 0;
+        cppsort::utility::partial_sort(collection, size / 2, [&](int lhs, int rhs) {
+            ++nb_comparisons;
+            return lhs < rhs;
+        });
+        CHECK( is_partially_sorted(collection, sorted, size / 2) );
+        CHECK( nb_comparisons < 50 * size );
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        std::deque<wrapper> collection;
+        for (int i = 0 ; i < 5000 ; ++i) {
+            collection.push_back({ i % 1000, std::to_string(i) });
+        }
+        std::shuffle(collection.begin(), collection.end(), engine);
+
+        for (std::ptrdiff_t k: { 5, 500, 4000 }) {
+            auto deq = collection;
+            cppsort::utility::partial_sort(deq, k, std::greater<>{}, &wrapper::value);
+            CHECK( std::is_sorted(deq.begin(), deq.begin() + k, [](const auto& lhs, const auto& rhs) {
+                return lhs.value > rhs.value;
+            }) );
+            auto kth = deq[k - 1].value;
+            CHECK( std::none_of(deq.begin() + k, deq.end(), [&](const auto& elem) {
+                return elem.value > kth;
+            }) );
+
+            deq = collection;
+            cppsort::utility::partial_sort(deq.begin(), deq.end(), k, &wrapper::name);
+            std::vector<std::string> names;
+            for (const auto& elem: collection) {
+                names.push_back(elem.name);
+            }
+            std::sort(names.begin(), names.end());
+            CHECK( std::equal(names.begin(), names.begin() + k, deq.begin(),
+                              [](const auto& name, const auto& elem) { return name == elem.name; }) );
+        }
+    }
+}
+
+TEST_CASE( "nth_element tests", "[utility][nth_element]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    SECTION( "random-access iterators" )
+    {
+        std::vector<int> collection(1000);
+        std::iota(collection.begin(), collection.end(), 0);
+        std::shuffle(collection.begin(), collection.end(), engine);
+
+        for (std::ptrdiff_t nth: { 0, 1, 500, 998, 999 }) {
+            auto vec = collection;
+            auto it = cppsort::utility::nth_element(vec, nth);
+            CHECK( it == vec.begin() + nth );
+            CHECK( *it == nth );
+            CHECK( std::all_of(vec.begin(), it, [&](int value) { return value < nth; }) );
+        }
+    }
+
+    SECTION( "adversarial input for quickselect" )
+    {
+        // The adversary makes every pivot as bad as possible while
+        // the algorithm runs, so a plain quickselect would perform
+        // a quadratic number of comparisons
+        const int size = 5000;
+        adversary_state state;
+        state.values.assign(size, size);
+        state.gas = size;
+        std::vector<int> indices(size);
+        std::iota(indices.begin(), indices.end(), 0);
+
+        long long nb_comparisons = 0;
+        adversary_less adversary{&state};
+        auto it = cppsort::utility::nth_element(indices, size / 2, [&](int lhs, int rhs) {
+            ++nb_comparisons;
+            return adversary(lhs, rhs);
+        });
+        CHECK( nb_comparisons < 50 * size );
+
+        auto values = state.values;
+        auto nth_value = values[*it];
+        std::sort(values.begin(), values.end());
+        CHECK( nth_value == values[size / 2] );
+    }
+
+    SECTION( "function object" )
+    {
+        std::vector<int> collection(100);
+        std::iota(collection.begin(), collection.end(), 0);
+        std::shuffle(collection.begin(), collection.end(), engine);
+
+        auto select = cppsort::utility::nth_element;
+        auto it = select(collection.begin(), collection.end(), 42, std::greater<>{});
+        CHECK( *it == 57 );
+    }
+
+    SECTION( "forward iterators with a projection" )
+    {
+        std::vector<wrapper> collection;
+        for (int i = 0 ; i < 1000 ; ++i) {
+            collection.push_back({ i, std::to_string(i) });
+        }
+        std::shuffle(collection.begin(), collection.end(), engine);
+        std::forward_list<wrapper> flist(collection.begin(), collection.end());
+
+        auto it = cppsort::utility::nth_element(flist.begin(), flist.end(), 250, &wrapper::value);
+        CHECK( it->value == 250 );
+        CHECK( std::distance(flist.begin(), it) == 250 );
+        CHECK( std::all_of(flist.begin(), it, [](const wrapper& elem) { return elem.value < 250; }) );
+        CHECK( std::all_of(it, flist.end(), [](const wrapper& elem) { return elem.value >= 250; }) );
+    }
+
+    SECTION( "forward iterators, every position" )
+    {
+        std::vector<int> collection;
+        for (int i = 0 ; i < 300 ; ++i) {
+            collection.push_back(i % 75);
+        }
+        std::shuffle(collection.begin(), collection.end(), engine);
+        auto sorted = collection;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (std::ptrdiff_t nth = 0 ; nth < 300 ; ++nth) {
+            std::forward_list<int> flist(collection.begin(), collection.end());
+            auto it = cppsort::utility::nth_element(flist, nth);
+            CHECK( *it == sorted[nth] );
+            CHECK( std::distance(flist.begin(), it) == nth );
+        }
+    }
+}
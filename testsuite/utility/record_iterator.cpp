@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters.h>
+#include <cpp-sort/utility/buffer.h>
+#include <cpp-sort/utility/record_iterator.h>
+
+namespace
+{
+    // Records of 13 bytes: a 4-byte key at offset 3, the rest
+    // of the bytes are derived from the key
+    constexpr std::size_t record_size = 13;
+    constexpr std::size_t key_offset = 3;
+
+    auto make_records(std::mt19937& engine, std::size_t size)
+        -> std::vector<unsigned char>
+    {
+        std::vector<unsigned char> res(size * record_size);
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            std::uint32_t key = engine() % 500;
+            unsigned char* record = res.data() + i * record_size;
+            for (std::size_t j = 0 ; j < record_size ; ++j) {
+                record[j] = static_cast<unsigned char>(key * 7 + j);
+            }
+            std::memcpy(record + key_offset, &key, sizeof(key));
+        }
+        return res;
+    }
+
+    auto check_records(const std::vector<unsigned char>& bytes)
+        -> bool
+    {
+        std::uint32_t previous = 0;
+        for (std::size_t i = 0 ; i < bytes.size() ; i += record_size) {
+            std::uint32_t key;
+            std::memcpy(&key, bytes.data() + i + key_offset, sizeof(key));
+            if (key < previous) return false;
+            for (std::size_t j = 0 ; j < record_size ; ++j) {
+                if (j >= key_offset && j < key_offset + sizeof(key)) continue;
+                if (bytes[i + j] != static_cast<unsigned char>(key * 7 + j)) return false;
+            }
+            previous = key;
+        }
+        return true;
+    }
+}
+
+TEMPLATE_TEST_CASE( "every random-access sorter with record_iterator", "[utility][record_iterator]",
+                    cppsort::block_sorter<cppsort::utility::fixed_buffer<0>>,
+                    cppsort::drop_merge_sorter,
+                    cppsort::grail_sorter<>,
+                    cppsort::heap_sorter,
+                    cppsort::insertion_sorter,
+                    cppsort::merge_insertion_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::poplar_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::quick_sorter,
+                    cppsort::selection_sorter,
+                    cppsort::ska_sorter,
+                    cppsort::smooth_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::split_sorter,
+                    cppsort::spread_sorter,
+                    cppsort::tim_sorter,
+                    cppsort::verge_sorter )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    auto bytes = make_records(engine, 491);
+
+    TestType sorter;
+    sorter(cppsort::utility::records(bytes.data(), bytes.size(), record_size),
+           cppsort::utility::record_field<std::uint32_t>(key_offset));
+    CHECK( check_records(bytes) );
+}
+
+TEST_CASE( "record_iterator tests", "[utility][record_iterator]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+
+    SECTION( "iter_move and iter_swap" )
+    {
+        unsigned char bytes[] = { 1, 2, 3, 4, 5, 6 };
+        auto range = cppsort::utility::records(bytes, sizeof(bytes), 2);
+        auto first = range.begin();
+        CHECK( range.size() == 3 );
+
+        using cppsort::utility::iter_move;
+        using cppsort::utility::iter_swap;
+
+        iter_swap(first, first + 2);
+        CHECK( bytes[0] == 5 );
+        CHECK( bytes[5] == 2 );
+
+        auto tmp = iter_move(first);
+        *first = first[1];
+        first[1] = std::move(tmp);
+        CHECK( std::equal(bytes, bytes + 6, std::vector<unsigned char>{ 3, 4, 5, 6, 1, 2 }.begin()) );
+    }
+
+    SECTION( "sort on the whole records" )
+    {
+        auto bytes = make_records(engine, 200);
+        auto range = cppsort::utility::records(bytes.data(), bytes.size(), record_size);
+        cppsort::pdq_sort(range);
+        CHECK( std::is_sorted(range.begin(), range.end()) );
+    }
+
+    SECTION( "sort on a range of bytes" )
+    {
+        auto bytes = make_records(engine, 200);
+        auto range = cppsort::utility::records(bytes.data(), bytes.size(), record_size);
+        cppsort::merge_sort(range, std::greater<>{},
+                            cppsort::utility::record_bytes(key_offset, 2));
+        auto proj = cppsort::utility::record_bytes(key_offset, 2);
+        CHECK( std::is_sorted(range.begin(), range.end(), [&](const auto& lhs, const auto& rhs) {
+            return proj(lhs) > proj(rhs);
+        }) );
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/resort.h>
+#include <testing-tools/move_only.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        std::string name;
+    };
+
+    // Counts the number of times it is moved
+    struct counted
+    {
+        int value;
+        int* nb_moves;
+
+        counted(int value, int* nb_moves):
+            value(value),
+            nb_moves(nb_moves)
+        {}
+
+        counted(counted&& other):
+            value(other.value),
+            nb_moves(other.nb_moves)
+        {
+            ++*nb_moves;
+        }
+
+        auto operator=(counted&& other)
+            -> counted&
+        {
+            value = other.value;
+            nb_moves = other.nb_moves;
+            ++*nb_moves;
+            return *this;
+        }
+    };
+}
+
+TEST_CASE( "resort tests", "[utility][resort]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    std::uniform_int_distribution<int> values(-10000, 10000);
+
+    SECTION( "modified elements anywhere" )
+    {
+        std::vector<int> collection(5000);
+        std::generate(collection.begin(), collection.end(), [&] { return values(engine); });
+        std::sort(collection.begin(), collection.end());
+
+        std::uniform_int_distribution<std::size_t> positions_dist(0, collection.size() - 1);
+        for (std::size_t nb_modified: { 0, 1, 2, 10, 300, 5000 }) {
+            auto vec = collection;
+            std::vector<std::size_t> positions;
+            for (std::size_t i = 0 ; i < nb_modified ; ++i) {
+                // Some positions are reported several times
+                auto pos = positions_dist(engine);
+                vec[pos] = values(engine);
+                positions.push_back(pos);
+            }
+            auto expected = vec;
+            std::sort(expected.begin(), expected.end());
+
+            cppsort::utility::resort(vec, positions);
+            CHECK( vec == expected );
+        }
+    }
+
+    SECTION( "modified elements at the edges" )
+    {
+        std::vector<int> vec = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        vec[0] = 100;
+        vec[9] = -100;
+        vec[5] = 5;
+        cppsort::utility::resort(vec.begin(), vec.end(), std::vector<int>{ 9, 0, 5 });
+        CHECK( vec == std::vector<int>{ -100, 1, 2, 3, 4, 5, 6, 7, 8, 100 } );
+    }
+
+    SECTION( "elements outside of the modified span don't move" )
+    {
+        int nb_moves = 0;
+        std::vector<counted> vec;
+        vec.reserve(10000);
+        for (int i = 0 ; i < 10000 ; ++i) {
+            vec.emplace_back(i * 10, &nb_moves);
+        }
+
+        // The modified element stays the smallest one
+        nb_moves = 0;
+        vec[0].value = -5;
+        cppsort::utility::resort(vec, std::vector<int>{ 0 }, &counted::value);
+        CHECK( vec[0].value == -5 );
+        CHECK( nb_moves <= 3 );
+
+        // Modified elements which go before and after the last
+        // modified position, close to where they started
+        nb_moves = 0;
+        vec[5000].value = 50075;
+        vec[5010].value = 50005;
+        cppsort::utility::resort(vec, std::vector<int>{ 5010, 5000 }, &counted::value);
+        CHECK( std::is_sorted(vec.begin(), vec.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        }) );
+        CHECK( vec[5000].value == 50005 );
+        CHECK( vec[5008].value == 50075 );
+        CHECK( nb_moves <= 30 );
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        std::deque<wrapper> collection;
+        for (int i = 0 ; i < 1000 ; ++i) {
+            collection.push_back({ values(engine), std::to_string(i) });
+        }
+        auto greater_value = [](const wrapper& lhs, const wrapper& rhs) {
+            return lhs.value > rhs.value;
+        };
+        std::sort(collection.begin(), collection.end(), greater_value);
+
+        std::vector<int> positions = { 999, 3, 500, 501, 0 };
+        for (int pos: positions) {
+            collection[pos].value = values(engine);
+        }
+        cppsort::utility::resort(collection, positions, std::greater<>{}, &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(), greater_value) );
+
+        std::vector<std::string> names;
+        for (const auto& elem: collection) {
+            names.push_back(elem.name);
+        }
+        std::sort(names.begin(), names.end());
+        CHECK( std::adjacent_find(names.begin(), names.end()) == names.end() );
+    }
+
+    SECTION( "move-only elements" )
+    {
+        std::vector<move_only<int>> vec;
+        for (int i = 0 ; i < 100 ; ++i) {
+            vec.emplace_back(i * 2);
+        }
+        vec[10] = move_only<int>(151);
+        vec[90] = move_only<int>(3);
+        cppsort::utility::resort(vec, std::vector<int>{ 10, 90 }, &move_only<int>::value);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+}
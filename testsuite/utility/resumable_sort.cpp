@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/resumable_sort.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/move_only.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        int order;
+    };
+}
+
+TEST_CASE( "resumable_sort tests", "[utility][resumable_sort]" )
+{
+    SECTION( "sort with bounded steps" )
+    {
+        for (std::size_t size: { 0, 1, 31, 32, 33, 64, 1000, 4097 }) {
+            std::vector<int> collection;
+            collection.reserve(size);
+            auto distribution = dist::shuffled{};
+            distribution(std::back_inserter(collection), size, -1000);
+            auto expected = collection;
+            std::sort(expected.begin(), expected.end());
+
+            cppsort::utility::resumable_sort<std::vector<int>::iterator> sorter(
+                collection.begin(), collection.end()
+            );
+            double progress = 0.0;
+            std::size_t nb_steps = 0;
+            while (not sorter.step(100)) {
+                CHECK( sorter.progress() >= progress );
+                CHECK( sorter.progress() < 1.0 );
+                progress = sorter.progress();
+                ++nb_steps;
+                // Every element is merged at most log2(size / 32) + 2 times
+                REQUIRE( nb_steps < 1000 );
+            }
+            CHECK( sorter.done() );
+            CHECK( sorter.progress() == 1.0 );
+            CHECK( collection == expected );
+        }
+    }
+
+    SECTION( "stability and projection" )
+    {
+        std::mt19937 engine(Catch::rngSeed());
+        std::uniform_int_distribution<int> values(0, 50);
+        std::vector<wrapper> collection;
+        for (int i = 0 ; i < 2000 ; ++i) {
+            collection.push_back({ values(engine), i });
+        }
+
+        cppsort::utility::resumable_sort<
+            std::vector<wrapper>::iterator, std::greater<>, int wrapper::*
+        > sorter(collection.begin(), collection.end(), {}, &wrapper::value);
+        while (not sorter.step(777)) {}
+
+        CHECK( std::is_sorted(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value > rhs.value || (lhs.value == rhs.value && lhs.order < rhs.order);
+        }) );
+    }
+
+    SECTION( "cancellation keeps every element" )
+    {
+        for (std::size_t nb_steps: { 0, 1, 5, 20, 41, 60 }) {
+            std::vector<move_only<int>> collection;
+            std::vector<int> values;
+            for (int i = 0 ; i < 1000 ; ++i) {
+                values.push_back((i * 7919) % 1000);
+                collection.emplace_back(values.back());
+            }
+
+            {
+                cppsort::utility::resumable_sort<std::vector<move_only<int>>::iterator> sorter(
+                    collection.begin(), collection.end()
+                );
+                for (std::size_t i = 0 ; i < nb_steps ; ++i) {
+                    sorter.step(97);
+                }
+                if (nb_steps % 2 == 0) {
+                    sorter.cancel();
+                    CHECK( (sorter.cancelled() || sorter.done()) );
+                }
+                // Otherwise the destructor puts the elements back
+            }
+
+            std::vector<int> remaining;
+            for (auto& elem: collection) {
+                REQUIRE( elem.can_read );
+                remaining.push_back(elem.value);
+            }
+            CHECK( std::is_permutation(remaining.begin(), remaining.end(), values.begin()) );
+        }
+    }
+}
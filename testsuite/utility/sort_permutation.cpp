@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/sort_permutation.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        std::string name;
+    };
+
+    template<typename Index, typename Collection, typename Compare, typename Projection>
+    auto is_sorting_permutation(const std::vector<Index>& indices, const Collection& collection,
+                                Compare compare, Projection projection, bool stable)
+        -> bool
+    {
+        auto&& proj = cppsort::utility::as_function(projection);
+        std::vector<typename Collection::const_iterator> its;
+        for (auto it = collection.begin() ; it != collection.end() ; ++it) {
+            its.push_back(it);
+        }
+
+        std::vector<Index> sorted_indices = indices;
+        std::sort(sorted_indices.begin(), sorted_indices.end());
+        for (std::size_t i = 0 ; i < sorted_indices.size() ; ++i) {
+            if (sorted_indices[i] != i) return false;
+        }
+
+        for (std::size_t i = 1 ; i < indices.size() ; ++i) {
+            const auto& prev = proj(*its[indices[i - 1]]);
+            const auto& curr = proj(*its[indices[i]]);
+            if (compare(curr, prev)) return false;
+            if (stable && not compare(prev, curr) && indices[i] < indices[i - 1]) return false;
+        }
+        return indices.size() == its.size();
+    }
+}
+
+TEST_CASE( "sort_permutation tests", "[utility][sort_permutation]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    std::vector<wrapper> collection;
+    for (int i = 0 ; i < 1000 ; ++i) {
+        int value = static_cast<int>(engine() % 100) - 50;
+        collection.push_back({ value, std::to_string(value % 10) });
+    }
+    auto copy = collection;
+
+    SECTION( "unstable with a comparison sorter" )
+    {
+        auto indices = cppsort::utility::sort_permutation(cppsort::pdq_sort, collection,
+                                                          std::greater<>{}, &wrapper::value);
+        static_assert(std::is_same<decltype(indices), std::vector<std::uint32_t>>::value, "");
+        CHECK( is_sorting_permutation(indices, collection, std::greater<>{}, &wrapper::value, false) );
+    }
+
+    SECTION( "unstable with a radix sorter" )
+    {
+        auto indices = cppsort::utility::sort_permutation(cppsort::ska_sort, collection,
+                                                          &wrapper::value);
+        CHECK( is_sorting_permutation(indices, collection, std::less<>{}, &wrapper::value, false) );
+    }
+
+    SECTION( "stable with a radix sorter" )
+    {
+        auto indices = cppsort::utility::stable_sort_permutation(cppsort::ska_sort, collection,
+                                                                 &wrapper::value);
+        CHECK( is_sorting_permutation(indices, collection, std::less<>{}, &wrapper::value, true) );
+    }
+
+    SECTION( "stable with an unstable comparison sorter" )
+    {
+        auto indices = cppsort::utility::stable_sort_permutation(cppsort::pdq_sort, collection,
+                                                                 std::greater<>{}, &wrapper::name);
+        CHECK( is_sorting_permutation(indices, collection, std::greater<>{}, &wrapper::name, true) );
+    }
+
+    SECTION( "stable with a stable sorter" )
+    {
+        auto indices = cppsort::utility::stable_sort_permutation<std::size_t>(
+            cppsort::merge_sort, collection, &wrapper::name
+        );
+        static_assert(std::is_same<decltype(indices), std::vector<std::size_t>>::value, "");
+        CHECK( is_sorting_permutation(indices, collection, std::less<>{}, &wrapper::name, true) );
+    }
+
+    SECTION( "bidirectional iterators" )
+    {
+        std::list<int> li;
+        for (auto& elem: collection) {
+            li.push_back(elem.value);
+        }
+        auto indices = cppsort::utility::stable_sort_permutation(cppsort::pdq_sort, li);
+        CHECK( is_sorting_permutation(indices, li, std::less<>{}, cppsort::utility::identity{}, true) );
+    }
+
+    // The collection itself is never modified
+    CHECK( std::equal(collection.begin(), collection.end(), copy.begin(),
+                      [](const auto& lhs, const auto& rhs) {
+                          return lhs.value == rhs.value && lhs.name == rhs.name;
+                      }) );
+}
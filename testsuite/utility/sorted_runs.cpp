@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/sorted_runs.h>
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+        std::string name;
+    };
+}
+
+TEST_CASE( "sorted_runs tests", "[utility][sorted_runs]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    std::uniform_int_distribution<int> values(-1000, 1000);
+    std::uniform_int_distribution<std::size_t> batch_sizes(0, 200);
+
+    SECTION( "smallest elements and full snapshots" )
+    {
+        cppsort::utility::sorted_runs<int, cppsort::pdq_sorter> runs;
+        std::vector<int> reference;
+
+        for (int i = 0 ; i < 100 ; ++i) {
+            std::vector<int> batch(batch_sizes(engine));
+            std::generate(batch.begin(), batch.end(), [&] { return values(engine); });
+            runs.push(batch);
+            reference.insert(reference.end(), batch.begin(), batch.end());
+            std::sort(reference.begin(), reference.end());
+
+            // Every run is more than twice as big as the next one
+            CHECK( runs.runs_count() <= 16 );
+            CHECK( runs.size() == reference.size() );
+
+            std::vector<int> smallest;
+            runs.copy_smallest(50, std::back_inserter(smallest));
+            auto expected_size = (std::min)(reference.size(), std::size_t(50));
+            CHECK( std::equal(smallest.begin(), smallest.end(),
+                              reference.begin(), reference.begin() + expected_size) );
+
+            if (i % 10 == 9) {
+                CHECK( runs.sorted() == reference );
+                CHECK( runs.runs_count() <= 1 );
+            }
+        }
+
+        std::vector<int> all;
+        runs.copy_smallest(runs.size() + 10, std::back_inserter(all));
+        CHECK( all == reference );
+
+        runs.clear();
+        CHECK( runs.empty() );
+        CHECK( runs.runs_count() == 0 );
+        CHECK( runs.sorted().empty() );
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        using runs_type = cppsort::utility::sorted_runs<
+            wrapper, cppsort::merge_sorter,
+            std::greater<>, decltype(&wrapper::value)
+        >;
+        runs_type runs({}, {}, &wrapper::value);
+        std::vector<wrapper> reference;
+
+        for (int i = 0 ; i < 30 ; ++i) {
+            std::vector<wrapper> batch;
+            for (std::size_t size = batch_sizes(engine) ; size > 0 ; --size) {
+                batch.push_back({ values(engine), std::to_string(i) });
+            }
+            runs.push(batch.begin(), batch.end());
+            reference.insert(reference.end(), batch.begin(), batch.end());
+        }
+
+        // Every sort and merge is stable here
+        std::stable_sort(reference.begin(), reference.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value > rhs.value;
+        });
+
+        std::vector<wrapper> smallest;
+        runs.copy_smallest(100, std::back_inserter(smallest));
+        auto same = [](const wrapper& lhs, const wrapper& rhs) {
+            return lhs.value == rhs.value && lhs.name == rhs.name;
+        };
+        CHECK( std::equal(smallest.begin(), smallest.end(), reference.begin(), same) );
+
+        const auto& sorted = runs.sorted();
+        CHECK( std::equal(sorted.begin(), sorted.end(), reference.begin(), reference.end(), same) );
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters.h>
+#include <cpp-sort/utility/buffer.h>
+#include <cpp-sort/utility/zip.h>
+
+namespace
+{
+    struct columns
+    {
+        std::vector<int> keys;
+        std::vector<std::string> names;
+        std::vector<std::unique_ptr<int>> payloads;
+    };
+
+    auto make_columns(std::mt19937& engine, int size)
+        -> columns
+    {
+        columns res;
+        for (int i = 0 ; i < size ; ++i) {
+            int key = static_cast<int>(engine() % 200) - 100;
+            res.keys.push_back(key);
+            res.names.push_back(std::to_string(key));
+            res.payloads.push_back(std::make_unique<int>(key));
+        }
+        return res;
+    }
+
+    auto check_columns(const columns& cols)
+        -> bool
+    {
+        if (not std::is_sorted(cols.keys.begin(), cols.keys.end())) {
+            return false;
+        }
+        for (std::size_t i = 0 ; i < cols.keys.size() ; ++i) {
+            if (cols.names[i] != std::to_string(cols.keys[i])) return false;
+            if (*cols.payloads[i] != cols.keys[i]) return false;
+        }
+        return true;
+    }
+}
+
+TEMPLATE_TEST_CASE( "every random-access sorter with zipped columns", "[utility][zip]",
+                    cppsort::block_sorter<cppsort::utility::fixed_buffer<0>>,
+                    cppsort::drop_merge_sorter,
+                    cppsort::grail_sorter<>,
+                    cppsort::heap_sorter,
+                    cppsort::insertion_sorter,
+                    cppsort::merge_insertion_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::poplar_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::quick_sorter,
+                    cppsort::selection_sorter,
+                    cppsort::ska_sorter,
+                    cppsort::smooth_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::split_sorter,
+                    cppsort::spread_sorter,
+                    cppsort::tim_sorter,
+                    cppsort::verge_sorter )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    auto cols = make_columns(engine, 491);
+
+    TestType sorter;
+    sorter(cppsort::utility::zip(cols.keys, cols.names, cols.payloads),
+           cppsort::utility::zip_element<0>{});
+    CHECK( check_columns(cols) );
+}
+
+TEST_CASE( "zip_iterator tests", "[utility][zip]" )
+{
+    std::mt19937 engine(Catch::rngSeed());
+    auto cols = make_columns(engine, 100);
+
+    SECTION( "iter_move and iter_swap" )
+    {
+        auto zipped = cppsort::utility::zip(cols.keys, cols.payloads);
+        auto first = zipped.begin();
+
+        using cppsort::utility::iter_move;
+        using cppsort::utility::iter_swap;
+
+        int key0 = cols.keys[0];
+        int key1 = cols.keys[1];
+        iter_swap(first, first + 1);
+        CHECK( cols.keys[0] == key1 );
+        CHECK( *cols.payloads[0] == key1 );
+
+        auto tmp = iter_move(first);
+        CHECK( std::get<0>(tmp) == key1 );
+        CHECK( *std::get<1>(tmp) == key1 );
+        CHECK( cols.payloads[0] == nullptr );
+        *first = iter_move(first + 1);
+        first[1] = std::move(tmp);
+        CHECK( cols.keys[0] == key0 );
+        CHECK( *cols.payloads[0] == key0 );
+        CHECK( *cols.payloads[1] == key1 );
+    }
+
+    SECTION( "sort on the whole tuples" )
+    {
+        // Ties on the key are broken by the second column
+        std::vector<int> keys = { 3, 1, 2, 1 };
+        std::vector<char> values = { 'z', 'y', 'x', 'w' };
+        cppsort::pdq_sort(cppsort::utility::zip(keys, values));
+        CHECK( keys == (std::vector<int>{ 1, 1, 2, 3 }) );
+        CHECK( values == (std::vector<char>{ 'w', 'y', 'x', 'z' }) );
+    }
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+
+//
+// Sort a binary file of fixed-size records in place through a
+// memory mapping, on a key found at a given byte offset:
+//
+//     sort_records FILE --record-size N --key-offset N --key-width N
+//                  [--key-type bytes|uint] [--sorter NAME]
+//
+// Keys of type "bytes" are compared lexicographically, which is
+// the right order for big-endian integers and text; keys of type
+// "uint" are unsigned integers of 1, 2, 4 or 8 bytes stored in
+// native byte order, which can also be sorted with radix sorters
+//
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <cpp-sort/sorters.h>
+#include <cpp-sort/utility/mapped_file.h>
+#include <cpp-sort/utility/record_iterator.h>
+
+using cppsort::utility::record_range;
+
+template<typename Projection>
+auto sort_comparison(const std::string& sorter, record_range range, Projection projection)
+    -> bool
+{
+    if (sorter == "pdq")        cppsort::pdq_sort(range, projection);
+    else if (sorter == "heap")  cppsort::heap_sort(range, projection);
+    else if (sorter == "merge") cppsort::merge_sort(range, projection);
+    else if (sorter == "quick") cppsort::quick_sort(range, projection);
+    else if (sorter == "spin")  cppsort::spin_sort(range, projection);
+    else if (sorter == "tim")   cppsort::tim_sort(range, projection);
+    else if (sorter == "verge") cppsort::verge_sort(range, projection);
+    else return false;
+    return true;
+}
+
+template<typename Projection>
+auto sort_radix(const std::string& sorter, record_range range, Projection projection)
+    -> bool
+{
+    if (sorter == "ska")         cppsort::ska_sort(range, projection);
+    else if (sorter == "spread") cppsort::spread_sort(range, projection);
+    else return false;
+    return true;
+}
+
+template<typename UnsignedInteger>
+auto sort_uint(const std::string& sorter, record_range range, std::size_t offset)
+    -> bool
+{
+    auto projection = cppsort::utility::record_field<UnsignedInteger>(offset);
+    return sort_comparison(sorter, range, projection)
+        || sort_radix(sorter, range, projection);
+}
+
+auto sort_records(const std::string& sorter, record_range range,
+                  const std::string& key_type, std::size_t offset, std::size_t width)
+    -> bool
+{
+    if (key_type == "bytes") {
+        return sort_comparison(sorter, range, cppsort::utility::record_bytes(offset, width));
+    }
+    switch (width) {
+        case 1: return sort_uint<std::uint8_t>(sorter, range, offset);
+        case 2: return sort_uint<std::uint16_t>(sorter, range, offset);
+        case 4: return sort_uint<std::uint32_t>(sorter, range, offset);
+        case 8: return sort_uint<std::uint64_t>(sorter, range, offset);
+        default:
+            std::cerr << "uint keys must be 1, 2, 4 or 8 bytes wide\n";
+            std::exit(EXIT_FAILURE);
+    }
+}
+
+[[noreturn]] void usage()
+{
+    std::cerr << "usage: sort_records FILE --record-size N --key-offset N --key-width N\n"
+                 "                    [--key-type bytes|uint] [--sorter NAME]\n"
+                 "sorters: pdq (default), heap, merge, quick, spin, tim, verge,\n"
+                 "         ska and spread (uint keys only)\n";
+    std::exit(EXIT_FAILURE);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string path;
+    std::size_t record_size = 0;
+    std::size_t key_offset = 0;
+    std::size_t key_width = 0;
+    std::string key_type = "bytes";
+    std::string sorter = "pdq";
+
+    for (int i = 1 ; i < argc ; ++i) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 2, "--") != 0) {
+            path = arg;
+            continue;
+        }
+        if (i + 1 == argc) {
+            usage();
+        }
+        std::string value = argv[++i];
+        if (arg == "--record-size")     record_size = std::stoul(value);
+        else if (arg == "--key-offset") key_offset = std::stoul(value);
+        else if (arg == "--key-width")  key_width = std::stoul(value);
+        else if (arg == "--key-type")   key_type = value;
+        else if (arg == "--sorter")     sorter = value;
+        else usage();
+    }
+
+    if (path.empty() || record_size == 0 || key_width == 0
+        || key_offset + key_width > record_size
+        || (key_type != "bytes" && key_type != "uint")) {
+        usage();
+    }
+
+    try {
+        cppsort::utility::mapped_file file(path);
+        if (file.size() % record_size != 0) {
+            std::cerr << "the size of the file is not a multiple of the record size\n";
+            return EXIT_FAILURE;
+        }
+        // Fault the whole file in at once instead of page per page
+        file.advise(cppsort::utility::access_advice::will_need);
+
+        auto range = cppsort::utility::records(file.data(), file.size(), record_size);
+        auto start = std::chrono::steady_clock::now();
+        if (not sort_records(sorter, range, key_type, key_offset, key_width)) {
+            std::cerr << "unknown sorter for " << key_type << " keys: " << sorter << '\n';
+            return EXIT_FAILURE;
+        }
+        auto end = std::chrono::steady_clock::now();
+        file.sync();
+
+        std::cout << "sorted " << range.size() << " records in "
+                  << std::chrono::duration<double>(end - start).count() << "s\n";
+    } catch (const std::exception& exc) {
+        std::cerr << exc.what() << '\n';
+        return EXIT_FAILURE;
+    }
+}